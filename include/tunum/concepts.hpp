@@ -44,6 +44,7 @@ namespace tunum
     // - 全順序比較
     // - 四則演算
     // - 単項 マイナス
+    // - 整数からの変換(整数への暗黙変換は不要なため、fmpint等も満たす)
     template <class T>
     concept TuArithmetic
         = std::is_arithmetic_v<T>
@@ -60,7 +61,6 @@ namespace tunum
         }
         && std::totally_ordered<T>
         && std::totally_ordered_with<T, int>
-        && std::convertible_to<T, int>
         && std::convertible_to<int, T>;
 
     // 整数の配列やコンテナ(添え字アクセスが可能なこと)
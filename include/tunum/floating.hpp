@@ -6,5 +6,8 @@
 #endif
 
 #include TUNUM_COMMON_INCLUDE(floating/deduction_guide.hpp)
+#include TUNUM_COMMON_INCLUDE(floating/fe_scope.hpp)
+#include TUNUM_COMMON_INCLUDE(floating/fe_span.hpp)
+#include TUNUM_COMMON_INCLUDE(floating/fe_vector.hpp)
 
 #endif
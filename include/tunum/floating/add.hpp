@@ -19,7 +19,7 @@ namespace tunum
         // -------------------------------------
 
         constexpr add(const fe_holder<Arg1, RaiseFeFlags>& arg1, const fe_holder<Arg2, RaiseFeFlags>& arg2)
-            : parent_t(fn, validate, check_result, arg1, arg2)
+            : parent_t(fn, validate, check_result, predict, arg1, arg2)
         {}
 
         // ---------------------------------------
@@ -29,6 +29,10 @@ namespace tunum
         static constexpr auto fn = [](calc_t arg1, calc_t arg2)
         { return arg1 + arg2; };
 
+        // 実行時に、引数と結果から浮動小数点例外を求める
+        static constexpr auto predict = [](calc_t result, calc_t arg1, calc_t arg2)
+        { return _fe_predict_impl::predict_add(arg1, arg2, result); };
+
         static constexpr auto validate = [](const info_t& info1, const info_t& info2) -> validate_result_t
         {
             const auto [e, is_run, return_value] = parent_t::validate_arg_default(info1, info2);
@@ -67,11 +71,9 @@ namespace tunum
             // if (result.is_infinity())
             //     return FE_INEXACT | FE_OVERFLOW;
 
-            // 結果がゼロなのに、符号をそろえたオペランドが異なる場合アンダーフロー
-            //  ->発生しうるの？
-            return (result.is_zero() && calc_t(arg1) != -calc_t(arg2))
-                ? FE_INEXACT | FE_UNDERFLOW
-                : parent_t::check_after_default(result, arg1, arg2);
+            // 有限数同士の和の丸め誤差より判定する
+            // 非正規化数となる和は常に正確であるため、アンダーフローは発生しない
+            return expand_fexcept(_fe_predict_impl::constant_add(calc_t(arg1), calc_t(arg2), calc_t(result)));
         };
     };
 }
@@ -14,7 +14,7 @@ namespace tunum
         using validate_result_t = typename parent_t::validate_result_t;
 
         constexpr div(const fe_holder<Arg1, RaiseFeFlags>& arg1, const fe_holder<Arg2, RaiseFeFlags>& arg2)
-            : parent_t(fn, validate, check_result, arg1, arg2)
+            : parent_t(fn, validate, check_result, predict, arg1, arg2)
         {}
 
         // ---------------------------------------
@@ -24,6 +24,10 @@ namespace tunum
         static constexpr auto fn = [](calc_t arg1, calc_t arg2)
         { return arg1 / arg2; };
 
+        // 実行時に、引数と結果から浮動小数点例外を求める
+        static constexpr auto predict = [](calc_t result, calc_t arg1, calc_t arg2)
+        { return _fe_predict_impl::predict_div(arg1, arg2, result); };
+
         static constexpr auto validate = [](const info_t& info1, const info_t& info2) -> validate_result_t
         {
             const auto [e, is_run, return_value] = parent_t::validate_arg_default(info1, info2);
@@ -32,11 +36,9 @@ namespace tunum
 
             const auto small = (std::min)(info1.change_sign(false), info2.change_sign(false));
             const auto large = (std::max)(info1.change_sign(false), info2.change_sign(false));
-            // どちらも無限またはどちらもゼロの時は不正
-            if (small.is_infinity())
+            // どちらも無限またはどちらもゼロの時は不正(ゼロ同士はゼロ除算とはしない)
+            if (small.is_infinity() || large.is_zero())
                 return  {FE_INVALID, false, info_t::get_nan()};
-            if (large.is_zero())
-                return  {FE_INVALID | FE_DIVBYZERO, false, info_t::get_nan()};
 
             const auto is_minus = info1.sign() != info2.sign();
             // 第二引数が0の時は無限
@@ -69,11 +71,8 @@ namespace tunum
             // if (result.is_infinity())
             //     return FE_INEXACT | FE_OVERFLOW;
 
-            // 結果がゼロなのに、どちらの引数もゼロではない
-            // (片方がゼロの場合は、検証時点ではじかれる)
-            return (result.is_denormalized() || result.is_zero())
-                ? FE_INEXACT | FE_UNDERFLOW
-                : std::fexcept_t{};
+            // どちらの引数も有限でゼロではない(検証時点ではじかれる)ため、丸め誤差より判定する
+            return expand_fexcept(_fe_predict_impl::constant_div(calc_t(arg1), calc_t(arg2), calc_t(result)));
         };
     };
 }
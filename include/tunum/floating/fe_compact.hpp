@@ -0,0 +1,47 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FLOATING_FE_COMPACT_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FLOATING_FE_COMPACT_HPP
+
+#include <cfenv>
+#include <cstdint>
+
+namespace tunum
+{
+    // IEEE754で規定される5種の浮動小数点例外のみを1byteに詰めた表現
+    // std::fexcept_tは処理系により幅やビット配置が異なるため、要素ごとの記録などにはこちらを用いる
+    using fe_compact_t = std::uint8_t;
+
+    // 各浮動小数点例外に対応するビット
+    inline constexpr fe_compact_t fe_compact_invalid = 1u << 0;
+    inline constexpr fe_compact_t fe_compact_divbyzero = 1u << 1;
+    inline constexpr fe_compact_t fe_compact_overflow = 1u << 2;
+    inline constexpr fe_compact_t fe_compact_underflow = 1u << 3;
+    inline constexpr fe_compact_t fe_compact_inexact = 1u << 4;
+
+    // std::fexcept_tを5bitの表現に圧縮
+    // @param e 浮動小数点例外
+    constexpr fe_compact_t compress_fexcept(std::fexcept_t e) noexcept
+    {
+        return static_cast<fe_compact_t>(
+            (static_cast<bool>(e & FE_INVALID) * fe_compact_invalid)
+            | (static_cast<bool>(e & FE_DIVBYZERO) * fe_compact_divbyzero)
+            | (static_cast<bool>(e & FE_OVERFLOW) * fe_compact_overflow)
+            | (static_cast<bool>(e & FE_UNDERFLOW) * fe_compact_underflow)
+            | (static_cast<bool>(e & FE_INEXACT) * fe_compact_inexact)
+        );
+    }
+
+    // 5bitに圧縮された浮動小数点例外をstd::fexcept_tに展開
+    // @param e 圧縮された浮動小数点例外
+    constexpr std::fexcept_t expand_fexcept(fe_compact_t e) noexcept
+    {
+        return static_cast<std::fexcept_t>(
+            (static_cast<bool>(e & fe_compact_invalid) * FE_INVALID)
+            | (static_cast<bool>(e & fe_compact_divbyzero) * FE_DIVBYZERO)
+            | (static_cast<bool>(e & fe_compact_overflow) * FE_OVERFLOW)
+            | (static_cast<bool>(e & fe_compact_underflow) * FE_UNDERFLOW)
+            | (static_cast<bool>(e & fe_compact_inexact) * FE_INEXACT)
+        );
+    }
+}
+
+#endif
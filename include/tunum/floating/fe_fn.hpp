@@ -3,10 +3,12 @@
 
 #include <cfenv>
 #include <array>
+#include <tuple>
 #include <algorithm>
 #include <stdexcept>
 #include TUNUM_COMMON_INCLUDE(submodule_loader.hpp)
 #include TUNUM_COMMON_INCLUDE(floating/fe_holder.hpp)
+#include TUNUM_COMMON_INCLUDE(floating/fe_predict.hpp)
 
 namespace tunum
 {
@@ -46,52 +48,41 @@ namespace tunum
         template <
             TuInvocableR<calc_t, to_calc_t<ArgsT>...> RunFn,
             TuInvocableR<validate_result_t, to_info_ref_t<ArgsT>...> ValidateFn,
-            TuInvocableR<std::fexcept_t, const info_t&, to_info_ref_t<ArgsT>...> CheckAfterFn
+            TuInvocableR<std::fexcept_t, const info_t&, to_info_ref_t<ArgsT>...> CheckAfterFn,
+            TuInvocableR<fe_compact_t, calc_t, to_calc_t<ArgsT>...> PredictFn
         >
         constexpr fe_fn(
             const RunFn& run,
             const ValidateFn& validate_args,
-            const CheckAfterFn& check_after, 
+            const CheckAfterFn& check_after,
+            const PredictFn& predict,
             const fe_holder<ArgsT, RaiseFeFlags>&... args
         )
             : fe_holder_t()
         {
-            // 事前検証
-            const auto [e, is_run, result_value] = validate_args(info_t{calc_t{args.value}}...);
-            auto new_e = e;
+            // 実行時は演算をそのまま行い、引数と結果から浮動小数点例外を求める
+            // ソフトウェアによる引数・結果の検証は定数式評価時のみ行う
+            const auto new_e = std::is_constant_evaluated()
+                ? run_with_validation(run, validate_args, check_after, args...)
+                : run_with_prediction(run, predict, args...);
 
-            // 演算未実施の場合
-            if (!is_run) {
-                this->value = result_value;
-            }
-            else {
-                // メインの機能実行
-                const auto calc_result = fe_holder_t([&] { return run(calc_t{args.value}...); } );
-                this->value = calc_result.value;
-
-                // runにより発生した例外と、事後チェックの例外をマージ
-                new_e |= calc_result.fexcepts
-                    | check_after(info_t{this->value}, info_t{calc_t{args.value}}...);
-            }
-            
             // 浮動小数点例外の伝播, 統合
             this->fexcepts |= new_e | (... | args.fexcepts);
 
             // 新規発生した浮動小数点例外について、例外を投げる奴は投げる
-            if constexpr (static_cast<bool>(RaiseFeFlags & FE_DIVBYZERO))
-                if (new_e & FE_DIVBYZERO)
-                    throw std::range_error("div by zero.");
-            if constexpr (static_cast<bool>(RaiseFeFlags & FE_INVALID))
-                if (new_e & FE_INVALID)
-                    throw std::domain_error("invalid calculate.");
-            if constexpr (static_cast<bool>(RaiseFeFlags & FE_OVERFLOW))
-                if (new_e & FE_OVERFLOW)
-                    throw std::overflow_error("");
-            if constexpr (static_cast<bool>(RaiseFeFlags & FE_UNDERFLOW))
-                if (new_e & FE_UNDERFLOW)
-                    throw std::underflow_error("");
+            raise_fexcept<RaiseFeFlags>(new_e);
         }
 
+        template <class RunFn, class ValidateFn, class CheckAfterFn>
+        constexpr fe_fn(
+            const RunFn& run,
+            const ValidateFn& validate_args,
+            const CheckAfterFn& check_after,
+            const fe_holder<ArgsT, RaiseFeFlags>&... args
+        )
+            : fe_fn(run, validate_args, check_after, predict_default, args...)
+        {}
+
         template <class RunFn, class ValidateFn>
         constexpr fe_fn(
             const RunFn& run,
@@ -109,6 +100,64 @@ namespace tunum
             : fe_fn(run, validate_arg_default, args...)
         {}
 
+        // ---------------------------------------
+        // 演算の実行
+        // ---------------------------------------
+
+        // 引数の事前検証、演算、結果の事後検証をソフトウェアで行う
+        // 定数式ではハードウェアの浮動小数点例外を参照できないため、こちらで例外を予測する
+        // @return 新規に発生した浮動小数点例外
+        template <class RunFn, class ValidateFn, class CheckAfterFn>
+        constexpr std::fexcept_t run_with_validation(
+            const RunFn& run,
+            const ValidateFn& validate_args,
+            const CheckAfterFn& check_after,
+            const fe_holder<ArgsT, RaiseFeFlags>&... args
+        )
+        {
+            // 事前検証
+            const auto [e, is_run, result_value] = validate_args(info_t{calc_t{args.value}}...);
+
+            // 演算未実施の場合
+            if (!is_run) {
+                this->value = result_value;
+                return e;
+            }
+
+            // メインの機能実行
+            const auto calc_result = fe_holder_t([&] { return run(calc_t{args.value}...); } );
+            this->value = calc_result.value;
+
+            // runにより発生した例外と、事後チェックの例外をマージ
+            return e
+                | calc_result.fexcepts
+                | check_after(info_t{this->value}, info_t{calc_t{args.value}}...);
+        }
+
+        // 演算をそのまま実行し、引数と結果から浮動小数点例外を求める
+        // fenvの退避、クリア、書き戻しを演算ごとに行わないため、実行時はこちらを使用する
+        // 演算自体がハードウェアへ立てた浮動小数点例外はそのまま残るため、
+        // 複数の演算の例外をまとめて収集する場合は fe_scope を用いる
+        // @return 新規に発生した浮動小数点例外
+        template <class RunFn, class PredictFn>
+        std::fexcept_t run_with_prediction(
+            const RunFn& run,
+            const PredictFn& predict,
+            const fe_holder<ArgsT, RaiseFeFlags>&... args
+        )
+        {
+            // volatileを経由し、演算がコンパイル時に畳み込まれてハードウェアの浮動小数点例外が失われることを防ぐ
+            this->value = run(volatile_load(calc_t{args.value})...);
+            return expand_fexcept(predict(this->value, calc_t{args.value}...));
+        }
+
+        // 最適化による値の伝播を止める
+        static calc_t volatile_load(calc_t v) noexcept
+        {
+            const volatile calc_t tmp = v;
+            return tmp;
+        }
+
         // ---------------------------------------
         // デフォルトの引数・結果検証処理
         // ---------------------------------------
@@ -133,6 +182,19 @@ namespace tunum
                 : std::fexcept_t{};
         }
 
+        // コンストラクタのデフォルト引数
+        // 任意の関数の丸め誤差は求められないため、結果の分類のみで判定する
+        static fe_compact_t predict_default(calc_t result, to_calc_t<ArgsT>... args)
+        {
+            const bool is_nan_args = (... || std::isnan(args));
+            const bool is_finity_args = (... && std::isfinite(args));
+            return static_cast<fe_compact_t>(
+                ((std::isnan(result) && !is_nan_args) * fe_compact_invalid)
+                | ((is_finity_args && std::isinf(result)) * (fe_compact_overflow | fe_compact_inexact))
+                | ((std::fpclassify(result) == FP_SUBNORMAL) * (fe_compact_underflow | fe_compact_inexact))
+            );
+        }
+
         // // 引数の検証を行う
         // // 実装は任意
         // // 本メソッドには、std_floating_infoが適用された値が渡されるので、
@@ -2,6 +2,9 @@
 #define TUNUM_INCLUDE_GUARD_TUNUM_FLOATING_FE_HOLDER_HPP
 
 #include <cfenv>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
 #include TUNUM_COMMON_INCLUDE(floating/std_info.hpp)
 
 namespace tunum
@@ -13,13 +16,16 @@ namespace tunum
     template <std::floating_point Arg1, std::floating_point Arg2, std::fexcept_t RaiseFeFlags = std::fexcept_t{}> struct div;
 
     // 浮動小数点例外を参照可能な算術型
+    // 値を先頭に置き、トリビアルコピー可能であるため、配列のコピーはmemcpyと同等となる
+    // アラインメントにより sizeof(T) の2倍の大きさとなるため、
+    // 多数の要素を保持する場合は、要素あたり sizeof(T) + 1byte で保持する fe_vector を用いる
     // @tparam T 任意の組み込み浮動小数点型
     // @tparam RaiseFeFlags 例外送出したい例外の種類を指定(bit論理和で複数指定可能で、FE_INEXACTは無視される)
     template <std::floating_point T, std::fexcept_t RaiseFeFlags = std::fexcept_t{}>
     struct fe_holder
     {
-        std::fexcept_t fexcepts = {};
         T value = {};
+        std::fexcept_t fexcepts = {};
 
         // -------------------------------------------
         // コンストラクタ
@@ -42,8 +48,8 @@ namespace tunum
         // 別のfe_holderオブジェクトより生成
         template <std::floating_point U, std::fexcept_t Flags>
         constexpr fe_holder(const fe_holder<U, Flags>& feh) noexcept
-            : fexcepts(feh.fexcepts)
-            , value(feh.value)
+            : value(feh.value)
+            , fexcepts(feh.fexcepts)
         {
             // RaiseFeFlagsが異なる型はコンパイルエラーとする
             static_assert(Flags == RaiseFeFlags);
@@ -149,6 +155,32 @@ namespace tunum
         { return has_fexcept(FE_UNDERFLOW); }
     };
 
+    // 配列での保持や一括コピーのため、レイアウトを保証
+    static_assert(std::is_trivially_copyable_v<fe_holder<float>>);
+    static_assert(std::is_trivially_copyable_v<fe_holder<double>>);
+    static_assert(std::is_standard_layout_v<fe_holder<double>>);
+    static_assert(offsetof(fe_holder<double>, value) == 0);
+
+    // 浮動小数点例外のうち、RaiseFeFlagsで指定されたものについて例外を送出する
+    // @tparam RaiseFeFlags 例外送出したい例外の種類を指定(bit論理和で複数指定可能で、FE_INEXACTは無視される)
+    // @param e 発生した浮動小数点例外
+    template <std::fexcept_t RaiseFeFlags>
+    constexpr void raise_fexcept(std::fexcept_t e)
+    {
+        if constexpr (static_cast<bool>(RaiseFeFlags & FE_DIVBYZERO))
+            if (e & FE_DIVBYZERO)
+                throw std::range_error("div by zero.");
+        if constexpr (static_cast<bool>(RaiseFeFlags & FE_INVALID))
+            if (e & FE_INVALID)
+                throw std::domain_error("invalid calculate.");
+        if constexpr (static_cast<bool>(RaiseFeFlags & FE_OVERFLOW))
+            if (e & FE_OVERFLOW)
+                throw std::overflow_error("");
+        if constexpr (static_cast<bool>(RaiseFeFlags & FE_UNDERFLOW))
+            if (e & FE_UNDERFLOW)
+                throw std::underflow_error("");
+    }
+
     // 浮動小数点例外保持型生成(主に、投げる例外指定時の型推論用)
     // @tparam RaiseFeFlags 例外送出したい例外の種類を指定(bit論理和で複数指定可能)
     // @param v fe_holderに変換したい浮動小数点型
@@ -0,0 +1,312 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FLOATING_FE_PREDICT_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FLOATING_FE_PREDICT_HPP
+
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <cstdint>
+#include <concepts>
+#include <type_traits>
+#include TUNUM_COMMON_INCLUDE(floating/fe_compact.hpp)
+
+namespace tunum::_fe_predict_impl
+{
+    // -------------------------------------------
+    // 四則演算の引数と結果から、ハードウェアが設定する浮動小数点例外を求める
+    // fenvへアクセスせずに演算ごとの例外を得るため、実行時の演算で用いる
+    // 丸め誤差は誤差なし変換(加減算は Fast2Sum、乗除算は fma による残差)で求め、
+    // 0でなければ FE_INEXACT とする
+    // 丸めモードは最近接偶数丸めを前提とし、シグナルNaNの引数は考慮しない
+    // 判定に用いる演算は、元の演算で発生しない浮動小数点例外を発生させない
+    // 判定結果を0/1の整数として合成することで、要素ごとの分岐を避ける
+    // -------------------------------------------
+
+    // 非正規化数となる結果について、アンダーフローの判定を丸め後に行う処理系か
+    // (x86は丸め後、その他の多くは丸め前に判定する)
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+    inline constexpr bool is_tininess_after_rounding = true;
+#else
+    inline constexpr bool is_tininess_after_rounding = false;
+#endif
+
+    template <std::floating_point T>
+    struct constants
+    {
+        using limits_t = std::numeric_limits<T>;
+
+        // 2の累乗
+        static constexpr T pow2(int n) noexcept
+        {
+            T v = 1;
+            for (; n > 0; n--)
+                v *= 2;
+            for (; n < 0; n++)
+                v /= 2;
+            return v;
+        }
+
+        static constexpr T min_normal = (limits_t::min)();
+        // 残差が非正規化数の範囲へ落ちないよう、絶対値がこれより小さい値は scale 倍して残差を求める
+        static constexpr T scale_threshold = min_normal * pow2(limits_t::digits * 2);
+        static constexpr T scale = pow2(limits_t::digits * 2 + 8);
+        // 正規化数の最小値の直下で、丸め後の判定では非正規化数とみなされない幅(正規化数の最小値に対する比)
+        static constexpr T tiny_margin_ratio = pow2(-limits_t::digits - 1);
+    };
+
+    // 結果が非正規化数またはゼロとなり、かつ不正確な場合にアンダーフロー
+    // 結果が正規化数の最小値の場合は、丸め前の値(残差より求める)で判定する
+    // @param signed_residual 結果から見て絶対値が大きくなる方向を正とした残差
+    // @param residual_factor 残差に掛かっている倍率(結果が正規化数の最小値の場合のみ参照する)
+    template <std::floating_point T>
+    inline bool is_underflow(T result, T signed_residual, T residual_factor, bool is_inexact) noexcept
+    {
+        using c = constants<T>;
+        const auto abs_r = std::fabs(result);
+        const bool is_min_normal = abs_r == c::min_normal;
+        // 正規化数の最小値以外の場合は、幅の計算で非正規化数が生じない値に置き換える
+        const auto factor = is_min_normal ? residual_factor : c::scale;
+        const auto margin = is_tininess_after_rounding ? c::min_normal * factor * c::tiny_margin_ratio : T{};
+        const bool is_tiny = std::isless(abs_r, c::min_normal)
+            | (is_min_normal & std::isless(signed_residual, -margin));
+        return is_tiny & is_inexact;
+    }
+
+    // 条件を満たさない場合はゼロとする
+    // 選択の後に演算が続く場合も条件分岐とならないよう、ビット演算で値を落とす
+    template <std::floating_point T>
+    inline T zero_unless(bool cond, T v) noexcept
+    {
+        if constexpr (sizeof(T) == sizeof(std::uint32_t) || sizeof(T) == sizeof(std::uint64_t)) {
+            using bits_t = std::conditional_t<sizeof(T) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+            return std::bit_cast<T>(std::bit_cast<bits_t>(v) & (bits_t{} - bits_t{cond}));
+        }
+        else
+            return cond ? v : T{};
+    }
+
+    // 符号(±1)
+    template <std::floating_point T>
+    inline T sign_of(T v) noexcept
+    { return std::copysign(T{1}, v); }
+
+    // 加算(減算は符号を反転した第二引数で求める)
+    template <std::floating_point T>
+    inline fe_compact_t predict_add(T arg1, T arg2, T result) noexcept
+    {
+        const bool is_nan_args = std::isnan(arg1) | std::isnan(arg2);
+        const bool is_finity_args = std::isfinite(arg1) & std::isfinite(arg2);
+        const bool is_overflow = is_finity_args & std::isinf(result);
+
+        // Fast2Sum (絶対値の大きい方から結果を引くことで、誤差が正確に求まる)
+        // 和が非正規化数の範囲となる場合は必ず正確であるため、アンダーフローは発生しない
+        // 無限大、NaNを含む場合は0に置き換えて計算する
+        const bool is_valid = is_finity_args & !is_overflow;
+        const bool is_swap = std::isless(std::fabs(arg1), std::fabs(arg2));
+        const auto large = zero_unless(is_valid, is_swap ? arg2 : arg1);
+        const auto small = zero_unless(is_valid, is_swap ? arg1 : arg2);
+        const auto error = small - (zero_unless(is_valid, result) - large);
+
+        return static_cast<fe_compact_t>(
+            // 異符号の無限大同士
+            ((std::isnan(result) & !is_nan_args) * fe_compact_invalid)
+            | (is_overflow * (fe_compact_overflow | fe_compact_inexact))
+            | ((error != 0) * fe_compact_inexact)
+        );
+    }
+
+    // 乗算
+    template <std::floating_point T>
+    inline fe_compact_t predict_mul(T arg1, T arg2, T result) noexcept
+    {
+        using c = constants<T>;
+        const bool is_nan_args = std::isnan(arg1) | std::isnan(arg2);
+        const bool is_finity_args = std::isfinite(arg1) & std::isfinite(arg2);
+        const bool is_overflow = is_finity_args & std::isinf(result);
+
+        // 残差 (arg1 * arg2 - result) * scale_factor
+        // 結果が小さい場合は、絶対値の小さい引数と結果を scale 倍する(どちらも scale 倍で桁あふれしない)
+        // 無限大、NaNを含む場合は0に置き換えて計算する
+        const bool is_valid = is_finity_args & !is_overflow;
+        const bool is_swap = std::isless(std::fabs(arg1), std::fabs(arg2));
+        const auto large = zero_unless(is_valid, is_swap ? arg2 : arg1);
+        const auto small = zero_unless(is_valid, is_swap ? arg1 : arg2);
+        const auto valid_result = zero_unless(is_valid, result);
+        const auto scale_factor = std::isless(std::fabs(valid_result), c::scale_threshold) ? c::scale : T{1};
+        // 結果がゼロへ丸められた場合は、残差も非正規化数の範囲を下回りうるため、引数を残差の代わりとする
+        // (どちらの引数もゼロでなければ不正確)
+        const auto residual = valid_result == 0
+            ? small
+            : std::fma(small * scale_factor, large, -(valid_result * scale_factor));
+        const bool is_inexact = is_overflow | (residual != 0);
+
+        return static_cast<fe_compact_t>(
+            // 無限大とゼロの乗算
+            ((std::isnan(result) & !is_nan_args) * fe_compact_invalid)
+            | (is_overflow * fe_compact_overflow)
+            | (is_underflow(result, sign_of(result) * residual, scale_factor, is_inexact) * fe_compact_underflow)
+            | (is_inexact * fe_compact_inexact)
+        );
+    }
+
+    // 除算
+    template <std::floating_point T>
+    inline fe_compact_t predict_div(T arg1, T arg2, T result) noexcept
+    {
+        using c = constants<T>;
+        const bool is_nan_args = std::isnan(arg1) | std::isnan(arg2);
+        const bool is_finity_args = std::isfinite(arg1) & std::isfinite(arg2);
+        const bool is_zero_arg2 = arg2 == 0;
+        const bool is_overflow = is_finity_args & !is_zero_arg2 & std::isinf(result);
+
+        // 残差 (arg1 - result * arg2) * scale_factor (= arg2 * (arg1 / arg2 - result) * scale_factor)
+        // 第一引数が小さい場合は、第一引数と結果を scale 倍する(どちらも scale 倍で桁あふれしない)
+        // 無限大、NaN、ゼロ除算を含む場合は0に置き換えて計算する
+        const bool is_valid = is_finity_args & !is_zero_arg2 & !is_overflow;
+        const auto valid_arg1 = zero_unless(is_valid, arg1);
+        const auto valid_arg2 = zero_unless(is_valid, arg2);
+        const auto valid_result = zero_unless(is_valid, result);
+        const auto scale_factor = std::isless(std::fabs(valid_arg1), c::scale_threshold) ? c::scale : T{1};
+        const auto residual = std::fma(-(valid_result * scale_factor), valid_arg2, valid_arg1 * scale_factor);
+        const bool is_inexact = is_overflow | (residual != 0);
+        // 残差を arg2 で割らずに判定できるよう、残差の倍率に |arg2| を含める
+        // (結果が正規化数の最小値となる場合のみ用いるため、それ以外は桁あふれしない値とする)
+        const auto abs_arg2 = std::fabs(result) == c::min_normal ? std::fabs(arg2) : T{1};
+
+        return static_cast<fe_compact_t>(
+            // 無限大同士、ゼロ同士の除算
+            ((std::isnan(result) & !is_nan_args) * fe_compact_invalid)
+            // 有限数(ゼロを除く)のゼロ除算
+            | ((is_zero_arg2 & std::isfinite(arg1) & (arg1 != 0)) * fe_compact_divbyzero)
+            | (is_overflow * fe_compact_overflow)
+            | (is_underflow(result, sign_of(result) * sign_of(arg2) * residual, abs_arg2 * scale_factor, is_inexact) * fe_compact_underflow)
+            | (is_inexact * fe_compact_inexact)
+        );
+    }
+
+    // -------------------------------------------
+    // 定数式での四則演算の丸めの判定
+    // 引数、結果ともに有限でゼロでなく、桁あふれしない演算のみを対象とする(floating/add.hpp等の事前検証の後に用いる)
+    // 定数式では fma や std::fabs 等を用いることができないため、引数を2の累乗倍して [1, 2) へ正規化し、
+    // Veltkamp の分割による誤差なし変換で丸め誤差を求める
+    // 判定結果は実行時の判定(predict_xxx)と一致する
+    // -------------------------------------------
+
+    // 2の累乗倍(結果が表現可能な範囲であれば正確)
+    template <std::floating_point T>
+    constexpr T scale_pow2(T v, int n) noexcept
+    {
+        constexpr auto step = constants<T>::pow2(32);
+        for (; n >= 32; n -= 32)
+            v *= step;
+        for (; n <= -32; n += 32)
+            v /= step;
+        for (; n > 0; n--)
+            v *= 2;
+        for (; n < 0; n++)
+            v /= 2;
+        return v;
+    }
+
+    // mantissa * 2^exponent (|mantissa| は [1, 2))
+    template <std::floating_point T>
+    struct normalized
+    {
+        T mantissa;
+        int exponent;
+    };
+
+    template <std::floating_point T>
+    constexpr normalized<T> normalize(T v) noexcept
+    {
+        constexpr auto step = constants<T>::pow2(32);
+        constexpr auto inv_step = constants<T>::pow2(-32);
+        auto m = v < 0 ? -v : v;
+        int e = 0;
+        for (; m >= step; e += 32)
+            m /= step;
+        for (; m < inv_step; e -= 32)
+            m *= step;
+        for (; m >= 2; e++)
+            m /= 2;
+        for (; m < 1; e--)
+            m *= 2;
+        return {v < 0 ? -m : m, e};
+    }
+
+    // 積の上位、下位(arg1 * arg2 == high + low)
+    // 絶対値が2未満の正規化数同士の積のみを対象とし、分割や積で桁あふれ、非正規化数が生じないようにする
+    template <std::floating_point T>
+    struct two_product
+    {
+        T high;
+        T low;
+    };
+
+    template <std::floating_point T>
+    constexpr two_product<T> mul_exactly(T arg1, T arg2) noexcept
+    {
+        constexpr auto split_factor = constants<T>::pow2((std::numeric_limits<T>::digits + 1) / 2) + 1;
+        const auto split = [](T v) {
+            const auto t = split_factor * v;
+            const auto high = t - (t - v);
+            return two_product<T>{high, v - high};
+        };
+        const auto high = arg1 * arg2;
+        const auto [h1, l1] = split(arg1);
+        const auto [h2, l2] = split(arg2);
+        return {high, ((h1 * h2 - high) + h1 * l2 + l1 * h2) + l1 * l2};
+    }
+
+    // 指数の範囲の制限がない場合の丸め結果 rounded * 2^exponent と、その丸め誤差の符号から、
+    // 実際の結果の例外を求める
+    // @param error 丸め前の値から rounded を引いた値と符号が同じ値(大きさは問わない)
+    template <std::floating_point T>
+    constexpr fe_compact_t classify_rounding(T result, T rounded, T error, int exponent) noexcept
+    {
+        constexpr auto min_exponent = std::numeric_limits<T>::min_exponent - 1;
+        const auto [m, e] = normalize(rounded);
+        const auto abs_m = m < 0 ? -m : m;
+        // 結果を元の倍率へ戻し、制限のない場合の丸め結果と異なれば、非正規化数への丸めにより不正確
+        const bool is_inexact = error != 0 || scale_pow2(result, -exponent) != rounded;
+        const bool is_tiny = is_tininess_after_rounding
+            ? e + exponent < min_exponent
+            : e + exponent < min_exponent || (e + exponent == min_exponent && abs_m == 1 && (error < 0) != (m < 0) && error != 0);
+        return static_cast<fe_compact_t>(
+            ((is_tiny && is_inexact) * fe_compact_underflow)
+            | (is_inexact * fe_compact_inexact)
+        );
+    }
+
+    // 加算(TwoSum による誤差が0でなければ不正確で、非正規化数となる和は常に正確)
+    template <std::floating_point T>
+    constexpr fe_compact_t constant_add(T arg1, T arg2, T result) noexcept
+    {
+        const auto arg2_part = result - arg1;
+        const auto error = (arg1 - (result - arg2_part)) + (arg2 - arg2_part);
+        return static_cast<fe_compact_t>((error != 0) * fe_compact_inexact);
+    }
+
+    // 乗算
+    template <std::floating_point T>
+    constexpr fe_compact_t constant_mul(T arg1, T arg2, T result) noexcept
+    {
+        const auto n1 = normalize(arg1), n2 = normalize(arg2);
+        const auto [high, low] = mul_exactly(n1.mantissa, n2.mantissa);
+        return classify_rounding(result, high, low, n1.exponent + n2.exponent);
+    }
+
+    // 除算
+    template <std::floating_point T>
+    constexpr fe_compact_t constant_div(T arg1, T arg2, T result) noexcept
+    {
+        const auto n1 = normalize(arg1), n2 = normalize(arg2);
+        const auto quotient = n1.mantissa / n2.mantissa;
+        // 剰余 n1 - quotient * n2 (商との積は n1 に近いため、n1 からの減算は正確)
+        const auto [high, low] = mul_exactly(quotient, n2.mantissa);
+        const auto remainder = (n1.mantissa - high) - low;
+        // 丸め前の商との差は remainder / n2 であるため、符号のみ合わせる
+        return classify_rounding(result, quotient, n2.mantissa < 0 ? -remainder : remainder, n1.exponent - n2.exponent);
+    }
+}
+
+#endif
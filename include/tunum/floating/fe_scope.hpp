@@ -0,0 +1,110 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FLOATING_FE_SCOPE_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FLOATING_FE_SCOPE_HPP
+
+#include <cfenv>
+#include <exception>
+#include TUNUM_COMMON_INCLUDE(floating/fe_holder.hpp)
+
+namespace tunum
+{
+    // スコープ内で発生した浮動小数点例外をまとめて収集するRAIIオブジェクト
+    // 生成時に一度だけ浮動小数点例外をクリアし、破棄時に収集した例外を書き戻したうえで、
+    // RaiseFeFlagsに指定された例外が発生していれば例外を送出する
+    // スコープ内の演算は組み込みの浮動小数点型のまま行えばよく、fenvへのアクセスはスコープ全体で一度で済む
+    // 定数式では浮動小数点例外を参照できないため、何も収集しない
+    // @tparam RaiseFeFlags 例外送出したい例外の種類を指定(bit論理和で複数指定可能で、FE_INEXACTは無視される)
+    template <std::fexcept_t RaiseFeFlags = std::fexcept_t{}>
+    class fe_scope
+    {
+        // スコープ開始前に発生していた浮動小数点例外
+        std::fexcept_t before_e = {};
+        // 破棄時に収集した浮動小数点例外を受け取る先
+        std::fexcept_t* output = nullptr;
+        // 生成時点で送出中の例外数(スタック巻き戻し中の破棄では例外を投げない)
+        int uncaught_count = 0;
+        bool is_closed = false;
+
+    public:
+        // -------------------------------------------
+        // コンストラクタ・デストラクタ
+        // -------------------------------------------
+
+        constexpr fe_scope()
+        {
+            if (!std::is_constant_evaluated()) {
+                uncaught_count = std::uncaught_exceptions();
+                std::fegetexceptflag(&before_e, FE_ALL_EXCEPT);
+                std::feclearexcept(FE_ALL_EXCEPT);
+            }
+        }
+
+        // 破棄時に、スコープ内で発生した浮動小数点例外をoutに書き込む
+        // @param out 浮動小数点例外の受け取り先
+        constexpr explicit fe_scope(std::fexcept_t& out)
+            : fe_scope()
+        { output = &out; }
+
+        fe_scope(const fe_scope&) = delete;
+        fe_scope& operator=(const fe_scope&) = delete;
+
+        // スタック巻き戻し中でなければ、例外を送出しうる
+        constexpr ~fe_scope() noexcept(false)
+        {
+            if (is_closed)
+                return;
+            const auto e = release();
+            if (std::is_constant_evaluated() || std::uncaught_exceptions() == uncaught_count)
+                raise_fexcept<RaiseFeFlags>(e);
+        }
+
+        // -------------------------------------
+        // メンバ関数
+        // -------------------------------------
+
+        // スコープ開始から現時点までに発生した浮動小数点例外を取得
+        constexpr std::fexcept_t fexcepts() const noexcept
+        {
+            auto e = std::fexcept_t{};
+            if (!std::is_constant_evaluated())
+                std::fegetexceptflag(&e, FE_ALL_EXCEPT);
+            return e;
+        }
+
+        // 引数で指定された例外が現時点までに発生しているか判定
+        constexpr bool has_fexcept(std::fexcept_t test_flags = FE_ALL_EXCEPT) const noexcept
+        { return static_cast<bool>(fexcepts() & test_flags); }
+
+        // 現時点までに発生した浮動小数点例外と共に、値をfe_holderへ包む
+        // @param v スコープ内で計算した値
+        template <std::floating_point T>
+        constexpr auto hold(T v) const noexcept
+        { return fe_holder<T, RaiseFeFlags>{v, fexcepts()}; }
+
+        // デストラクタを待たずにスコープを閉じる
+        // 収集した浮動小数点例外を書き戻し、RaiseFeFlagsに該当する例外を送出する
+        // @return スコープ内で発生した浮動小数点例外
+        constexpr std::fexcept_t close()
+        {
+            const auto e = release();
+            raise_fexcept<RaiseFeFlags>(e);
+            return e;
+        }
+
+    private:
+        // 収集した浮動小数点例外を、スコープ開始前の例外も含め書き戻す
+        constexpr std::fexcept_t release() noexcept
+        {
+            is_closed = true;
+            const auto e = fexcepts();
+            if (!std::is_constant_evaluated()) {
+                auto restore_e = static_cast<std::fexcept_t>(before_e | e);
+                std::fesetexceptflag(&restore_e, FE_ALL_EXCEPT);
+            }
+            if (output)
+                *output = e;
+            return e;
+        }
+    };
+}
+
+#endif
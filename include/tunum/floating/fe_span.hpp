@@ -0,0 +1,209 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FLOATING_FE_SPAN_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FLOATING_FE_SPAN_HPP
+
+#include <span>
+#include <limits>
+#include <cstdint>
+#include <stdexcept>
+#include TUNUM_COMMON_INCLUDE(floating/deduction_guide.hpp)
+#include TUNUM_COMMON_INCLUDE(floating/fe_compact.hpp)
+#include TUNUM_COMMON_INCLUDE(floating/fe_predict.hpp)
+
+namespace tunum::_fe_span_impl
+{
+    // 定数式でのソフトウェアによる検証(floating/add.hpp等)が可能な型か
+    // ビット表現にパディングを含む型(x87の拡張倍精度など)は、実行時のみ対応する
+    template <std::floating_point T>
+    inline constexpr bool is_validatable_v = std::numeric_limits<T>::is_iec559
+        && sizeof(T) <= sizeof(std::uint64_t);
+
+    // --------------------------------------------
+    // 各演算の実行と、引数と結果からの浮動小数点例外の判定
+    // 判定はfe_holderの実行時の演算と共通(floating/fe_predict.hpp)で、ハードウェアの浮動小数点例外と一致する
+    // --------------------------------------------
+
+    struct add_op
+    {
+        template <class T, std::fexcept_t RaiseFeFlags>
+        using scalar_t = add<T, T, RaiseFeFlags>;
+
+        template <class T>
+        static constexpr T run(T arg1, T arg2) noexcept
+        { return arg1 + arg2; }
+
+        template <class T>
+        static fe_compact_t check(T arg1, T arg2, T result) noexcept
+        { return _fe_predict_impl::predict_add(arg1, arg2, result); }
+    };
+
+    struct sub_op
+    {
+        template <class T, std::fexcept_t RaiseFeFlags>
+        using scalar_t = sub<T, T, RaiseFeFlags>;
+
+        template <class T>
+        static constexpr T run(T arg1, T arg2) noexcept
+        { return arg1 - arg2; }
+
+        template <class T>
+        static fe_compact_t check(T arg1, T arg2, T result) noexcept
+        { return _fe_predict_impl::predict_add(arg1, -arg2, result); }
+    };
+
+    struct mul_op
+    {
+        template <class T, std::fexcept_t RaiseFeFlags>
+        using scalar_t = mul<T, T, RaiseFeFlags>;
+
+        template <class T>
+        static constexpr T run(T arg1, T arg2) noexcept
+        { return arg1 * arg2; }
+
+        template <class T>
+        static fe_compact_t check(T arg1, T arg2, T result) noexcept
+        { return _fe_predict_impl::predict_mul(arg1, arg2, result); }
+    };
+
+    struct div_op
+    {
+        template <class T, std::fexcept_t RaiseFeFlags>
+        using scalar_t = div<T, T, RaiseFeFlags>;
+
+        template <class T>
+        static constexpr T run(T arg1, T arg2) noexcept
+        { return arg1 / arg2; }
+
+        template <class T>
+        static fe_compact_t check(T arg1, T arg2, T result) noexcept
+        { return _fe_predict_impl::predict_div(arg1, arg2, result); }
+    };
+
+    // 配列の要素ごとに演算を実行し、浮動小数点例外を集約する
+    // @tparam IsElementwise 要素ごとの浮動小数点例外をfexceptsへ記録するか
+    template <class Op, std::fexcept_t RaiseFeFlags, bool IsElementwise, std::floating_point T>
+    constexpr std::fexcept_t apply(
+        std::span<const T> arg1,
+        std::span<const T> arg2,
+        std::span<T> result,
+        std::span<fe_compact_t> fexcepts
+    )
+    {
+        if (arg1.size() != arg2.size() || arg1.size() != result.size())
+            throw std::invalid_argument("Sizes of the argument spans are different.");
+        if (IsElementwise && fexcepts.size() != result.size())
+            throw std::invalid_argument("Size of the fexcept span is different.");
+
+        auto total = fe_compact_t{};
+        if (std::is_constant_evaluated()) {
+            // 定数式ではソフトウェアによる検証を要素ごとに行う
+            if constexpr (is_validatable_v<T>)
+                for (std::size_t i = 0; i < result.size(); ++i) {
+                    const auto v = typename Op::template scalar_t<T, std::fexcept_t{}>{arg1[i], arg2[i]};
+                    const auto e = compress_fexcept(v.fexcepts);
+                    result[i] = v.value;
+                    if constexpr (IsElementwise)
+                        fexcepts[i] = e;
+                    total |= e;
+                }
+            else
+                throw std::logic_error("Constant evaluation is not supported for this floating point type.");
+        }
+        else {
+            // 要素ごとの分岐を含まない
+            for (std::size_t i = 0; i < result.size(); ++i) {
+                const auto a = arg1[i], b = arg2[i];
+                const auto r = Op::run(a, b);
+                const auto e = Op::check(a, b, r);
+                result[i] = r;
+                if constexpr (IsElementwise)
+                    fexcepts[i] = e;
+                total |= e;
+            }
+        }
+
+        const auto total_e = expand_fexcept(total);
+        raise_fexcept<RaiseFeFlags>(total_e);
+        return total_e;
+    }
+}
+
+namespace tunum
+{
+    // ----------------------------------------------------------
+    // 配列に対する浮動小数点例外を考慮した四則演算
+    // 各要素の演算結果をresultへ格納し、配列全体で発生した浮動小数点例外を返却する
+    // 引数の配列と結果の配列は同一でもよい
+    // 要素ごとの浮動小数点例外が必要な場合は、fexceptsを指定する(5bitに圧縮した表現で記録)
+    // RaiseFeFlagsに該当する例外は、全要素の演算後に送出する
+    // ----------------------------------------------------------
+
+    // 配列の要素ごとの加算
+    template <std::fexcept_t RaiseFeFlags = std::fexcept_t{}, std::floating_point T, std::size_t Extent>
+    constexpr std::fexcept_t fe_add(
+        std::span<const std::type_identity_t<T>> arg1,
+        std::span<const std::type_identity_t<T>> arg2,
+        std::span<T, Extent> result
+    )
+    { return _fe_span_impl::apply<_fe_span_impl::add_op, RaiseFeFlags, false, T>(arg1, arg2, result, {}); }
+    template <std::fexcept_t RaiseFeFlags = std::fexcept_t{}, std::floating_point T, std::size_t Extent>
+    constexpr std::fexcept_t fe_add(
+        std::span<const std::type_identity_t<T>> arg1,
+        std::span<const std::type_identity_t<T>> arg2,
+        std::span<T, Extent> result,
+        std::span<fe_compact_t> fexcepts
+    )
+    { return _fe_span_impl::apply<_fe_span_impl::add_op, RaiseFeFlags, true, T>(arg1, arg2, result, fexcepts); }
+
+    // 配列の要素ごとの減算
+    template <std::fexcept_t RaiseFeFlags = std::fexcept_t{}, std::floating_point T, std::size_t Extent>
+    constexpr std::fexcept_t fe_sub(
+        std::span<const std::type_identity_t<T>> arg1,
+        std::span<const std::type_identity_t<T>> arg2,
+        std::span<T, Extent> result
+    )
+    { return _fe_span_impl::apply<_fe_span_impl::sub_op, RaiseFeFlags, false, T>(arg1, arg2, result, {}); }
+    template <std::fexcept_t RaiseFeFlags = std::fexcept_t{}, std::floating_point T, std::size_t Extent>
+    constexpr std::fexcept_t fe_sub(
+        std::span<const std::type_identity_t<T>> arg1,
+        std::span<const std::type_identity_t<T>> arg2,
+        std::span<T, Extent> result,
+        std::span<fe_compact_t> fexcepts
+    )
+    { return _fe_span_impl::apply<_fe_span_impl::sub_op, RaiseFeFlags, true, T>(arg1, arg2, result, fexcepts); }
+
+    // 配列の要素ごとの乗算
+    template <std::fexcept_t RaiseFeFlags = std::fexcept_t{}, std::floating_point T, std::size_t Extent>
+    constexpr std::fexcept_t fe_mul(
+        std::span<const std::type_identity_t<T>> arg1,
+        std::span<const std::type_identity_t<T>> arg2,
+        std::span<T, Extent> result
+    )
+    { return _fe_span_impl::apply<_fe_span_impl::mul_op, RaiseFeFlags, false, T>(arg1, arg2, result, {}); }
+    template <std::fexcept_t RaiseFeFlags = std::fexcept_t{}, std::floating_point T, std::size_t Extent>
+    constexpr std::fexcept_t fe_mul(
+        std::span<const std::type_identity_t<T>> arg1,
+        std::span<const std::type_identity_t<T>> arg2,
+        std::span<T, Extent> result,
+        std::span<fe_compact_t> fexcepts
+    )
+    { return _fe_span_impl::apply<_fe_span_impl::mul_op, RaiseFeFlags, true, T>(arg1, arg2, result, fexcepts); }
+
+    // 配列の要素ごとの除算
+    template <std::fexcept_t RaiseFeFlags = std::fexcept_t{}, std::floating_point T, std::size_t Extent>
+    constexpr std::fexcept_t fe_div(
+        std::span<const std::type_identity_t<T>> arg1,
+        std::span<const std::type_identity_t<T>> arg2,
+        std::span<T, Extent> result
+    )
+    { return _fe_span_impl::apply<_fe_span_impl::div_op, RaiseFeFlags, false, T>(arg1, arg2, result, {}); }
+    template <std::fexcept_t RaiseFeFlags = std::fexcept_t{}, std::floating_point T, std::size_t Extent>
+    constexpr std::fexcept_t fe_div(
+        std::span<const std::type_identity_t<T>> arg1,
+        std::span<const std::type_identity_t<T>> arg2,
+        std::span<T, Extent> result,
+        std::span<fe_compact_t> fexcepts
+    )
+    { return _fe_span_impl::apply<_fe_span_impl::div_op, RaiseFeFlags, true, T>(arg1, arg2, result, fexcepts); }
+}
+
+#endif
@@ -0,0 +1,173 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FLOATING_FE_VECTOR_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FLOATING_FE_VECTOR_HPP
+
+#include <span>
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+#include <initializer_list>
+#include TUNUM_COMMON_INCLUDE(floating/fe_holder.hpp)
+#include TUNUM_COMMON_INCLUDE(floating/fe_compact.hpp)
+
+namespace tunum
+{
+    // fe_holderの可変長配列
+    // 値と、5bitに圧縮した浮動小数点例外を別々の配列に保持し、要素あたり sizeof(T) + 1byte とする
+    // (fe_holderをそのまま並べる場合はアラインメントにより sizeof(T) の2倍となる)
+    // 要素はfe_holderとして取り出し、代入する(参照は値と浮動小数点例外を指す代理オブジェクト)
+    // 値と浮動小数点例外の配列はspanとして取り出せるため、fe_add等の配列の演算へそのまま渡せる
+    // @tparam T 任意の組み込み浮動小数点型
+    // @tparam RaiseFeFlags 要素の型(fe_holder)のRaiseFeFlags
+    template <std::floating_point T, std::fexcept_t RaiseFeFlags = std::fexcept_t{}>
+    class fe_vector
+    {
+    public:
+        using value_type = fe_holder<T, RaiseFeFlags>;
+
+        // 要素への参照
+        class reference
+        {
+            T& value;
+            fe_compact_t& compact_fexcepts;
+
+        public:
+            constexpr reference(T& v, fe_compact_t& e) noexcept
+                : value(v)
+                , compact_fexcepts(e)
+            {}
+
+            constexpr operator value_type() const noexcept
+            { return value_type{value, expand_fexcept(compact_fexcepts)}; }
+
+            constexpr reference& operator=(const value_type& v) noexcept
+            {
+                value = v.value;
+                compact_fexcepts = compress_fexcept(v.fexcepts);
+                return *this;
+            }
+
+            // 参照同士の代入は、参照先の要素の複写とする
+            constexpr reference& operator=(const reference& r) noexcept
+            { return *this = static_cast<value_type>(r); }
+        };
+
+    private:
+        std::vector<T> values = {};
+        std::vector<fe_compact_t> compact_fexcepts = {};
+
+    public:
+        // -------------------------------------------
+        // コンストラクタ
+        // -------------------------------------------
+
+        constexpr fe_vector() = default;
+
+        // 値がゼロで、浮動小数点例外のないn要素で生成
+        constexpr explicit fe_vector(std::size_t n)
+            : values(n)
+            , compact_fexcepts(n)
+        {}
+
+        constexpr fe_vector(std::initializer_list<value_type> init)
+        {
+            reserve(init.size());
+            for (const auto& v : init)
+                push_back(v);
+        }
+
+        // -------------------------------------------
+        // 容量
+        // -------------------------------------------
+
+        constexpr std::size_t size() const noexcept
+        { return values.size(); }
+
+        constexpr bool empty() const noexcept
+        { return values.empty(); }
+
+        constexpr void reserve(std::size_t n)
+        {
+            values.reserve(n);
+            compact_fexcepts.reserve(n);
+        }
+
+        // 増えた要素は値がゼロで、浮動小数点例外のない状態とする
+        constexpr void resize(std::size_t n)
+        {
+            values.resize(n);
+            compact_fexcepts.resize(n);
+        }
+
+        constexpr void clear() noexcept
+        {
+            values.clear();
+            compact_fexcepts.clear();
+        }
+
+        // -------------------------------------------
+        // 要素アクセス
+        // -------------------------------------------
+
+        constexpr reference operator[](std::size_t i) noexcept
+        { return reference{values[i], compact_fexcepts[i]}; }
+        constexpr value_type operator[](std::size_t i) const noexcept
+        { return value_type{values[i], expand_fexcept(compact_fexcepts[i])}; }
+
+        constexpr reference at(std::size_t i)
+        {
+            check_index(i);
+            return (*this)[i];
+        }
+        constexpr value_type at(std::size_t i) const
+        {
+            check_index(i);
+            return (*this)[i];
+        }
+
+        // 値の配列
+        constexpr std::span<T> value_span() noexcept
+        { return values; }
+        constexpr std::span<const T> value_span() const noexcept
+        { return values; }
+
+        // 要素ごとの浮動小数点例外(5bitに圧縮した表現)の配列
+        constexpr std::span<fe_compact_t> fexcept_span() noexcept
+        { return compact_fexcepts; }
+        constexpr std::span<const fe_compact_t> fexcept_span() const noexcept
+        { return compact_fexcepts; }
+
+        // 全要素の浮動小数点例外を集約したもの
+        constexpr std::fexcept_t fexcepts() const noexcept
+        {
+            auto e = fe_compact_t{};
+            for (const auto v : compact_fexcepts)
+                e |= v;
+            return expand_fexcept(e);
+        }
+
+        // -------------------------------------------
+        // 変更
+        // -------------------------------------------
+
+        constexpr void push_back(const value_type& v)
+        {
+            values.push_back(v.value);
+            compact_fexcepts.push_back(compress_fexcept(v.fexcepts));
+        }
+
+        constexpr void pop_back()
+        {
+            values.pop_back();
+            compact_fexcepts.pop_back();
+        }
+
+    private:
+        constexpr void check_index(std::size_t i) const
+        {
+            if (i >= size())
+                throw std::out_of_range("The index is out of range.");
+        }
+    };
+}
+
+#endif
@@ -14,7 +14,7 @@ namespace tunum
         using validate_result_t = typename parent_t::validate_result_t;
 
         constexpr mul(const fe_holder<Arg1, RaiseFeFlags>& arg1, const fe_holder<Arg2, RaiseFeFlags>& arg2)
-            : parent_t(fn, validate, check_result, arg1, arg2)
+            : parent_t(fn, validate, check_result, predict, arg1, arg2)
         {}
 
         // ---------------------------------------
@@ -24,6 +24,10 @@ namespace tunum
         static constexpr auto fn = [](calc_t arg1, calc_t arg2)
         { return arg1 * arg2; };
 
+        // 実行時に、引数と結果から浮動小数点例外を求める
+        static constexpr auto predict = [](calc_t result, calc_t arg1, calc_t arg2)
+        { return _fe_predict_impl::predict_mul(arg1, arg2, result); };
+
         static constexpr auto validate = [](const info_t& info1, const info_t& info2) -> validate_result_t
         {
             const auto [e, is_run, return_value] = parent_t::validate_arg_default(info1, info2);
@@ -66,11 +70,9 @@ namespace tunum
             // if (result.is_infinity())
             //     return FE_INEXACT | FE_OVERFLOW;
 
-            // 結果がゼロなのに、どちらの引数もゼロではない
-            // (片方がゼロの場合は、検証時点ではじかれる)
-            return (result.is_denormalized() || result.is_zero())
-                ? FE_INEXACT | FE_UNDERFLOW
-                : std::fexcept_t{};
+            // どちらの引数も有限でゼロではない(検証時点ではじかれる)ため、丸め誤差より判定する
+            // 結果が非正規化数やゼロでも、正確であればアンダーフローとしない
+            return expand_fexcept(_fe_predict_impl::constant_mul(calc_t(arg1), calc_t(arg2), calc_t(result)));
         };
     };
 }
@@ -8,5 +8,18 @@
 #include TUNUM_COMMON_INCLUDE(fmpint/operator.hpp)
 #include TUNUM_COMMON_INCLUDE(fmpint/alias.hpp)
 #include TUNUM_COMMON_INCLUDE(fmpint/literals.hpp)
+#include TUNUM_COMMON_INCLUDE(fmpint/packed.hpp)
+#include TUNUM_COMMON_INCLUDE(fmpint/normalized.hpp)
+#include TUNUM_COMMON_INCLUDE(fmpint/expression.hpp)
+#include TUNUM_COMMON_INCLUDE(fmpint/limits.hpp)
+#include TUNUM_COMMON_INCLUDE(fmpint/overflow.hpp)
+#include TUNUM_COMMON_INCLUDE(fmpint/hash.hpp)
+#include TUNUM_COMMON_INCLUDE(fmpint/bytes.hpp)
+#include TUNUM_COMMON_INCLUDE(fmpint/varint.hpp)
+#include TUNUM_COMMON_INCLUDE(fmpint/parse.hpp)
+#include TUNUM_COMMON_INCLUDE(fmpint/mapped.hpp)
+#include TUNUM_COMMON_INCLUDE(fmpint/flat_map.hpp)
+#include TUNUM_COMMON_INCLUDE(fmpint/sorted_index.hpp)
+#include TUNUM_COMMON_INCLUDE(fmpint/radix_sort.hpp)
 
 #endif
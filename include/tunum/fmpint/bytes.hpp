@@ -0,0 +1,238 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_BYTES_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_BYTES_HPP
+
+#include <bit>
+#include <span>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <algorithm>
+#include <type_traits>
+#include TUNUM_COMMON_INCLUDE(fmpint/core.hpp)
+
+namespace tunum
+{
+    // -------------------------------------------
+    // バイト列との相互変換
+    // fmpintは内部表現の大きさ(sizeof(T) == T::size)のバイト列として読み書きする
+    // fmpintはトリビアルコピー可能かつスタンダードレイアウトであり、
+    // リトルエンディアン環境での内部表現はリトルエンディアンのバイト列と一致する
+    // -------------------------------------------
+
+    namespace _bytes_impl
+    {
+        template <class T>
+        using bytes_t = std::array<std::byte, sizeof(T)>;
+
+        template <class T>
+        using limbs_t = std::array<typename T::base_data_t, T::data_length>;
+
+        template <class T>
+        constexpr void assert_layout() noexcept
+        {
+            static_assert(std::is_trivially_copyable_v<T> && std::is_standard_layout_v<T>);
+            static_assert(sizeof(T) == T::size);
+        }
+
+        constexpr std::uint32_t byteswap(std::uint32_t v) noexcept
+        { return (v << 24) | ((v << 8) & 0x00FF'0000) | ((v >> 8) & 0x0000'FF00) | (v >> 24); }
+
+        // 要素ごとのバイト順をリトルエンディアンと環境との間で変換
+        template <class T>
+        constexpr limbs_t<T> swap_limbs_if_big_endian(limbs_t<T> limbs) noexcept
+        {
+            if constexpr (std::endian::native != std::endian::little)
+                for (auto& v : limbs)
+                    v = byteswap(v);
+            return limbs;
+        }
+
+        template <class T>
+        constexpr bytes_t<T> to_le_bytes(const T& v) noexcept
+        {
+            if constexpr (std::endian::native == std::endian::little)
+                return std::bit_cast<bytes_t<T>>(v);
+            else
+                return std::bit_cast<bytes_t<T>>(swap_limbs_if_big_endian<T>(std::bit_cast<limbs_t<T>>(v)));
+        }
+
+        template <class T>
+        constexpr T from_le_bytes(const bytes_t<T>& bytes) noexcept
+        {
+            if constexpr (std::endian::native == std::endian::little)
+                return std::bit_cast<T>(bytes);
+            else
+                return std::bit_cast<T>(swap_limbs_if_big_endian<T>(std::bit_cast<limbs_t<T>>(bytes)));
+        }
+
+        template <class T>
+        constexpr bytes_t<T> to_be_bytes(const T& v) noexcept
+        {
+            auto bytes = to_le_bytes(v);
+            std::reverse(bytes.begin(), bytes.end());
+            return bytes;
+        }
+
+        template <class T>
+        constexpr T from_be_bytes(bytes_t<T> bytes) noexcept
+        {
+            std::reverse(bytes.begin(), bytes.end());
+            return from_le_bytes<T>(bytes);
+        }
+
+        template <class T>
+        constexpr bytes_t<T> read_bytes(std::span<const std::byte> in)
+        {
+            if (in.size() < sizeof(T))
+                throw std::out_of_range{"Not enough bytes to load fmpint."};
+            auto bytes = bytes_t<T>{};
+            std::copy_n(in.begin(), bytes.size(), bytes.begin());
+            return bytes;
+        }
+
+        template <class T>
+        constexpr void write_bytes(const bytes_t<T>& bytes, std::span<std::byte> out)
+        {
+            if (out.size() < sizeof(T))
+                throw std::out_of_range{"Not enough bytes to store fmpint."};
+            std::copy(bytes.begin(), bytes.end(), out.begin());
+        }
+
+        // 一括変換のバイト数の確認
+        constexpr void check_bulk_size(std::size_t bytes, std::size_t count, std::size_t element_size)
+        {
+            if (bytes / element_size < count)
+                throw std::out_of_range{"Not enough bytes for fmpint array."};
+        }
+
+        // 一括変換の1要素分の読み書き
+        // バイト数は check_bulk_size で確認済みとし、要素ごとには確認しない
+        template <class T>
+        constexpr T load_le_at(const std::byte* in) noexcept
+        {
+            auto bytes = bytes_t<T>{};
+            std::copy_n(in, bytes.size(), bytes.begin());
+            return from_le_bytes<T>(bytes);
+        }
+
+        template <class T>
+        constexpr T load_be_at(const std::byte* in) noexcept
+        {
+            auto bytes = bytes_t<T>{};
+            std::reverse_copy(in, in + bytes.size(), bytes.begin());
+            return from_le_bytes<T>(bytes);
+        }
+
+        template <class T>
+        constexpr void store_le_at(const T& v, std::byte* out) noexcept
+        {
+            const auto bytes = to_le_bytes(v);
+            std::copy(bytes.begin(), bytes.end(), out);
+        }
+
+        template <class T>
+        constexpr void store_be_at(const T& v, std::byte* out) noexcept
+        {
+            const auto bytes = to_le_bytes(v);
+            std::reverse_copy(bytes.begin(), bytes.end(), out);
+        }
+    }
+
+    // -------------------------------------------
+    // 1要素の読み書き
+    // バイト列が足りない場合は std::out_of_range を送出する
+    // -------------------------------------------
+
+    template <TuFmpIntegral T>
+    constexpr T load_le(std::span<const std::byte> in)
+    {
+        _bytes_impl::assert_layout<T>();
+        return _bytes_impl::from_le_bytes<T>(_bytes_impl::read_bytes<T>(in));
+    }
+
+    template <TuFmpIntegral T>
+    constexpr T load_be(std::span<const std::byte> in)
+    {
+        _bytes_impl::assert_layout<T>();
+        return _bytes_impl::from_be_bytes<T>(_bytes_impl::read_bytes<T>(in));
+    }
+
+    template <TuFmpIntegral T>
+    constexpr void store_le(const T& v, std::span<std::byte> out)
+    {
+        _bytes_impl::assert_layout<T>();
+        _bytes_impl::write_bytes<T>(_bytes_impl::to_le_bytes(v), out);
+    }
+
+    template <TuFmpIntegral T>
+    constexpr void store_be(const T& v, std::span<std::byte> out)
+    {
+        _bytes_impl::assert_layout<T>();
+        _bytes_impl::write_bytes<T>(_bytes_impl::to_be_bytes(v), out);
+    }
+
+    // -------------------------------------------
+    // 配列の一括読み書き
+    // out(またはin)の全要素を、バイト列の先頭から sizeof(T) バイトずつ隙間なく読み書きする
+    // バイト数の確認は最初に1回だけ行い、足りない場合は何も書き込まずに std::out_of_range を送出する
+    // リトルエンディアン環境のリトルエンディアンは1回のmemcpyとなり、
+    // ビッグエンディアンは要素ごとのバイト順の反転となる
+    // (SSSE3/AVX2が有効な場合(-march=x86-64-v3 等)はバイトシャッフル命令へベクトル化されるが、
+    //  既定のx86-64ではバイト単位の読み書きとなる)
+    // -------------------------------------------
+
+    template <TuFmpIntegral T>
+    constexpr void load_le(std::span<const std::byte> in, std::span<T> out)
+    {
+        _bytes_impl::assert_layout<T>();
+        _bytes_impl::check_bulk_size(in.size(), out.size(), sizeof(T));
+        if constexpr (std::endian::native == std::endian::little)
+            if (!std::is_constant_evaluated()) {
+                if (!out.empty())
+                    std::memcpy(out.data(), in.data(), out.size_bytes());
+                return;
+            }
+        for (std::size_t i = 0; i < out.size(); i++)
+            out[i] = _bytes_impl::load_le_at<T>(in.data() + i * sizeof(T));
+    }
+
+    template <TuFmpIntegral T>
+    constexpr void load_be(std::span<const std::byte> in, std::span<T> out)
+    {
+        _bytes_impl::assert_layout<T>();
+        _bytes_impl::check_bulk_size(in.size(), out.size(), sizeof(T));
+        for (std::size_t i = 0; i < out.size(); i++)
+            out[i] = _bytes_impl::load_be_at<T>(in.data() + i * sizeof(T));
+    }
+
+    template <class T>
+    requires TuFmpIntegral<std::remove_const_t<T>>
+    constexpr void store_le(std::span<T> in, std::span<std::byte> out)
+    {
+        using fmpint_t = std::remove_const_t<T>;
+        _bytes_impl::assert_layout<fmpint_t>();
+        _bytes_impl::check_bulk_size(out.size(), in.size(), sizeof(fmpint_t));
+        if constexpr (std::endian::native == std::endian::little)
+            if (!std::is_constant_evaluated()) {
+                if (!in.empty())
+                    std::memcpy(out.data(), in.data(), in.size_bytes());
+                return;
+            }
+        for (std::size_t i = 0; i < in.size(); i++)
+            _bytes_impl::store_le_at(in[i], out.data() + i * sizeof(fmpint_t));
+    }
+
+    template <class T>
+    requires TuFmpIntegral<std::remove_const_t<T>>
+    constexpr void store_be(std::span<T> in, std::span<std::byte> out)
+    {
+        using fmpint_t = std::remove_const_t<T>;
+        _bytes_impl::assert_layout<fmpint_t>();
+        _bytes_impl::check_bulk_size(out.size(), in.size(), sizeof(fmpint_t));
+        for (std::size_t i = 0; i < in.size(); i++)
+            _bytes_impl::store_be_at(in[i], out.data() + i * sizeof(fmpint_t));
+    }
+}
+
+#endif
@@ -4,11 +4,14 @@
 #include TUNUM_COMMON_INCLUDE(floating.hpp)
 #include TUNUM_COMMON_INCLUDE(number_array.hpp)
 #include TUNUM_COMMON_INCLUDE(fmpint/impl/arithmetic.hpp)
+#include TUNUM_COMMON_INCLUDE(fmpint/impl/scalar.hpp)
 
 #include <array>
 #include <stdexcept>
 #include <compare>
 #include <limits>
+#include <utility>
+#include <optional>
 
 namespace tunum
 {
@@ -63,7 +66,7 @@ namespace tunum
         {
             // このクラスも、指定された整数どちらも64ビットの場合のみ
             if constexpr (size == sizeof(v))
-                this->upper = std::rotl(v, half_size * 8);
+                this->upper = std::rotl(static_cast<std::make_unsigned_t<decltype(v)>>(v), half_size * 8);
         }
 
         // 異なる符号同士は引数の符号を反転したうえで別コンストラクタに委譲
@@ -81,10 +84,11 @@ namespace tunum
         {}
 
         // 異なるサイズのfmpintから生成(内部表現が小さい)
+        // 下位の半分も符号拡張が必要な場合があるため、半分の大きさへ拡張してから格納する
         template <std::size_t N>
         requires (fmpint<N, Signed>::size < size)
         constexpr fmpint(const fmpint<N, Signed>& v) noexcept
-            : lower(v._to_unsigned())
+            : lower(fmpint<half_size, Signed>{v}._to_unsigned())
             , upper(v._is_minus() ? ~half_fmpint{} : half_fmpint{})
         {}
 
@@ -266,24 +270,66 @@ namespace tunum
         }
 
         // 加算代入
+        // 組み込みの整数の場合は、fmpintへ拡張せずに計算する
+        // 同じ型のfmpintの場合は、一時オブジェクトを作らずに直接加算する
         constexpr auto& operator+=(const TuIntegral auto& v) noexcept
-        { return *this = get_arithmetic(v).add(); }
+        {
+            using arith = _fmpint_impl::arithmetic<Bytes, Signed>;
+            if constexpr (std::integral<std::remove_cvref_t<decltype(v)>>)
+                return *this = (v < 0)
+                    ? _fmpint_impl::sub_1(*this, _fmpint_impl::scalar_abs(v))
+                    : _fmpint_impl::add_1(*this, _fmpint_impl::scalar_abs(v));
+            else if constexpr (std::same_as<std::remove_cvref_t<decltype(v)>, fmpint>)
+                arith::add_to(*this, v);
+            else
+                arith::add_to(*this, fmpint{v});
+            return *this;
+        }
 
         // 減算代入
         constexpr auto& operator-=(const TuIntegral auto& v) noexcept
-        { return *this += -fmpint{v}; }
+        {
+            using arith = _fmpint_impl::arithmetic<Bytes, Signed>;
+            if constexpr (std::integral<std::remove_cvref_t<decltype(v)>>)
+                return *this = (v < 0)
+                    ? _fmpint_impl::add_1(*this, _fmpint_impl::scalar_abs(v))
+                    : _fmpint_impl::sub_1(*this, _fmpint_impl::scalar_abs(v));
+            else if constexpr (std::same_as<std::remove_cvref_t<decltype(v)>, fmpint>)
+                arith::sub_from(*this, v);
+            else
+                arith::sub_from(*this, fmpint{v});
+            return *this;
+        }
 
         // 乗算代入
+        // 組み込みの整数の絶対値が32bitに収まる場合は、fmpintへ拡張せずに計算する
         constexpr auto& operator*=(const TuIntegral auto& v) noexcept
-        { return *this = get_arithmetic(v).mul(); }
+        {
+            if constexpr (std::integral<std::remove_cvref_t<decltype(v)>>) {
+                if (const auto abs_v = _fmpint_impl::scalar_abs(v); _fmpint_impl::is_single_limb(abs_v)) {
+                    *this = _fmpint_impl::mul_1(*this, static_cast<base_data_t>(abs_v));
+                    return (v < 0) ? *this = -*this : *this;
+                }
+            }
+            return *this = _get_arithmetic(v).mul();
+        }
 
         // 除算代入
+        // 組み込みの整数の絶対値が32bitに収まる場合は、fmpintへ拡張せずに計算する
         constexpr auto& operator/=(const TuIntegral auto& v)
-        { return *this = get_arithmetic(v).div(); }
+        {
+            if (const auto divmod = _divmod_scalar(v))
+                return *this = divmod->first;
+            return *this = _get_arithmetic(v).div();
+        }
     
         // 剰余代入
         constexpr auto& operator%=(const TuIntegral auto& v)
-        { return *this -= (v * (*this / v)); }
+        {
+            if (const auto divmod = _divmod_scalar(v))
+                return *this = divmod->second;
+            return *this -= (v * (*this / v));
+        }
 
         // 前後インクリメント
         constexpr auto& operator++() noexcept
@@ -301,9 +347,6 @@ namespace tunum
         // 演算子等のthis適用済み実装クラス取得
         // -------------------------------------------
 
-        constexpr auto get_arithmetic(const TuIntegral auto& v) const noexcept
-        { return _fmpint_impl::arithmetic{*this, fmpint{v}}; }
-
         constexpr auto get_bit_operator() const noexcept
         { return _fmpint_impl::bit_operator{*this}; }
         
@@ -336,6 +379,11 @@ namespace tunum
             }
         }
 
+        // 演算の実装クラス取得(演算子の実装用)
+        // 戻り値はオペランドを参照で保持するため、同一の完全式内でのみ使用すること
+        constexpr auto _get_arithmetic(const fmpint& v) const noexcept
+        { return _fmpint_impl::arithmetic{*this, v}; }
+
         // マイナスかどうか判定
         constexpr bool _is_minus() const noexcept
         { return Signed && get_bit_operator().get_back_bit(); }
@@ -358,6 +406,32 @@ namespace tunum
             return new_obj;
         }
 
+        // 組み込みの整数による除算
+        // 商は0方向へ丸め、余りの符号は被除数に合わせる(組み込みの整数に準拠)
+        // fmpintへ拡張して計算する必要がある場合は無効値を返却
+        constexpr std::optional<std::pair<fmpint, fmpint>> _divmod_scalar(const TuIntegral auto& v) const
+        {
+            if constexpr (std::integral<std::remove_cvref_t<decltype(v)>>) {
+                // 符号なしを負の値で除算する場合は、負の値を符号なしへ変換した値が除数となる
+                if (!Signed && v < 0)
+                    return std::nullopt;
+                const auto abs_v = _fmpint_impl::scalar_abs(v);
+                if (!abs_v)
+                    throw std::invalid_argument{"0 div."};
+                if (!_fmpint_impl::is_single_limb(abs_v))
+                    return std::nullopt;
+
+                const bool is_minus = _is_minus();
+                const auto [quo, rem] = _fmpint_impl::divmod_1(is_minus ? -*this : *this, static_cast<base_data_t>(abs_v));
+                return std::pair{
+                    (is_minus != (v < 0)) ? -quo : quo,
+                    is_minus ? -fmpint{rem} : fmpint{rem}
+                };
+            }
+            else
+                return std::nullopt;
+        }
+
         // 比較
         template <bool _Signed>
         constexpr std::strong_ordering _compare(const fmpint<Bytes, _Signed>& v) const noexcept
@@ -382,44 +456,13 @@ namespace tunum
                 : inner_compare(this->lower, v.lower);
         }
 
-        // 10 の n乗をあらかじめ計算しておく
-        static constexpr auto _calc_table_10_n()
-        {
-            using unsigned_t = fmpint<Bytes, false>;
-            std::array<unsigned_t, max_digits10 + 1> table{};
-            int i = 1;
-            table[0] = 1;
-            if constexpr (!is_min_size) {
-                constexpr auto half_table = half_fmpint::_calc_table_10_n();
-                for (; i <= half_fmpint::max_digits10; i++)
-                    table[i] = half_table[i];
-                for (const auto begin_i = half_fmpint::max_digits10; i <= max_digits10; i++)
-                    table[i] = unsigned_t{table[half_fmpint::max_digits10]} *= table[i - begin_i];
-            }
-            else
-                for (; i <= max_digits10; i++)
-                    table[i] = unsigned_t{table[i - 1]} * 10;
-            return table;
-        }
-
         // 10進数文字列からオブジェクト生成
+        // 上位の桁から順に、10倍して次の桁を加える
         static constexpr auto _make_by_digits10_arr(const std::array<int, max_digits10 + 1>& num_arr)
         {
-            const auto table_10_n = _calc_table_10_n();
             fmpint new_obj{};
-            std::size_t i = 0;
-            if constexpr (!is_min_size) {
-                std::array<int, half_fmpint::max_digits10 + 1> half_num_arr = {};
-                for (int j = 0; auto& num : half_num_arr)
-                    num = num_arr[j++];
-                // 一つ下のサイズの最大要素はオーバーフローする可能性があるため、
-                // 委譲対象外とする
-                half_num_arr[i = half_fmpint::max_digits10] = 0;
-                new_obj.lower = half_fmpint::_make_by_digits10_arr(half_num_arr);
-            }
-            for (; i <= max_digits10; i++)
-                if (const auto num = num_arr[i]; num > 0)
-                    new_obj += (fmpint{table_10_n[i]} *= num);
+            for (auto i = num_arr.size(); i-- > 0;)
+                new_obj = _fmpint_impl::mul_add_1(new_obj, 10, static_cast<base_data_t>((std::max)(num_arr[i], 0)));
             return new_obj;
         }
 
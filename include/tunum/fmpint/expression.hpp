@@ -0,0 +1,163 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_EXPRESSION_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_EXPRESSION_HPP
+
+#include <bit>
+#include <span>
+#include <array>
+#include <stdexcept>
+#include <algorithm>
+#include TUNUM_COMMON_INCLUDE(fmpint/operator.hpp)
+#include TUNUM_COMMON_INCLUDE(fmpint/impl/limb_div.hpp)
+
+namespace tunum::fmpint_expr
+{
+    // ----------------------------------
+    // fmpintの遅延評価式
+    // lazy() で包んだオペランドから始まる式は、演算子の適用時点では計算せず、評価時にまとめて計算する
+    // - lazy(a) + b + c + ...   : 全オペランドの加算を1回の桁上りの伝搬で計算
+    // - acc += lazy(a) * b      : 積を保持せず、accへ直接積和を計算(addmul)
+    // - (lazy(a) * b) % m       : 商を保持せず、余りのみ計算(符号なしのみ)
+    // 式はオペランドへの参照を保持するため、オペランドより長く保持しないこと
+    // ----------------------------------
+
+    template <class T>
+    using limbs_t = std::array<std::uint32_t, T::data_length>;
+
+    // 複数オペランドの和
+    template <TuFmpIntegral T, std::size_t N>
+    struct sum
+    {
+        std::array<const T*, N> operands;
+
+        // 全オペランドを同時に加算する
+        constexpr T eval() const noexcept
+        {
+            std::array<limbs_t<T>, N> limbs{};
+            for (std::size_t k = 0; k < N; k++)
+                limbs[k] = std::bit_cast<limbs_t<T>>(*operands[k]);
+
+            auto result = limbs_t<T>{};
+            std::uint64_t carry = 0;
+            for (std::size_t i = 0; i < result.size(); i++) {
+                for (const auto& l : limbs)
+                    carry += l[i];
+                result[i] = static_cast<std::uint32_t>(carry);
+                carry >>= 32;
+            }
+            return std::bit_cast<T>(result);
+        }
+
+        constexpr operator T() const noexcept
+        { return eval(); }
+
+        friend constexpr sum<T, N + 1> operator+(const sum& l, const T& r) noexcept
+        {
+            sum<T, N + 1> result{};
+            std::copy(l.operands.begin(), l.operands.end(), result.operands.begin());
+            result.operands.back() = &r;
+            return result;
+        }
+    };
+
+    // 2オペランドの積の剰余
+    template <TuFmpIntegral T>
+    struct mod_product
+    {
+        static_assert(is_unsigned_v<T>, "The remainder of a lazy product is only defined for unsigned fmpint.");
+
+        const T& op_l;
+        const T& op_r;
+        const T& modulus;
+
+        // 積を32bit単位の配列として求め、余りのみ算出する
+        constexpr T eval() const
+        {
+            const auto m_limbs = std::bit_cast<limbs_t<T>>(modulus);
+            const auto m = _fmpint_impl::trimmed(m_limbs);
+            if (m.empty())
+                throw std::invalid_argument{"0 div."};
+            const auto l_limbs = std::bit_cast<limbs_t<T>>(op_l);
+            const auto r_limbs = std::bit_cast<limbs_t<T>>(op_r);
+            auto product = _fmpint_impl::mul_limbs(l_limbs, r_limbs);
+            _fmpint_impl::trim_limbs(product);
+
+            auto result = limbs_t<T>{};
+            if (_fmpint_impl::compare_limbs(product, m) < 0)
+                std::copy(product.begin(), product.end(), result.begin());
+            else if (m.size() == 1) {
+                std::uint64_t rem = 0;
+                for (auto i = product.size(); i-- > 0;)
+                    rem = ((rem << 32) | product[i]) % m[0];
+                result[0] = static_cast<std::uint32_t>(rem);
+            }
+            else
+                _fmpint_impl::divmod_limbs(product, m, {}, std::span{result}.first(m.size()));
+            return std::bit_cast<T>(result);
+        }
+
+        constexpr operator T() const
+        { return eval(); }
+    };
+
+    // 2オペランドの積
+    template <TuFmpIntegral T>
+    struct product
+    {
+        const T& op_l;
+        const T& op_r;
+
+        // 桁あふれした部分を破棄した積
+        constexpr T eval() const noexcept
+        { return op_l * op_r; }
+
+        constexpr operator T() const noexcept
+        { return eval(); }
+
+        // acc += l * r
+        // 積の各要素を求めると同時に acc の該当位置へ加算し、accの範囲を超える部分は計算しない
+        friend constexpr T& operator+=(T& acc, const product& p) noexcept
+        {
+            auto acc_limbs = std::bit_cast<limbs_t<T>>(acc);
+            const auto l = std::bit_cast<limbs_t<T>>(p.op_l);
+            const auto r = std::bit_cast<limbs_t<T>>(p.op_r);
+            constexpr auto n = acc_limbs.size();
+            for (std::size_t i = 0; i < n; i++) {
+                if (!l[i])
+                    continue;
+                std::uint64_t carry = 0;
+                for (std::size_t j = 0; i + j < n; j++) {
+                    carry += std::uint64_t{l[i]} * r[j] + acc_limbs[i + j];
+                    acc_limbs[i + j] = static_cast<std::uint32_t>(carry);
+                    carry >>= 32;
+                }
+            }
+            return acc = std::bit_cast<T>(acc_limbs);
+        }
+
+        friend constexpr mod_product<T> operator%(const product& p, const T& m) noexcept
+        { return {p.op_l, p.op_r, m}; }
+    };
+
+    // 遅延評価式の起点となるオペランド
+    template <TuFmpIntegral T>
+    struct operand
+    {
+        const T& value;
+
+        friend constexpr sum<T, 2> operator+(const operand& l, const T& r) noexcept
+        { return {{&l.value, &r}}; }
+
+        friend constexpr product<T> operator*(const operand& l, const T& r) noexcept
+        { return {l.value, r}; }
+    };
+}
+
+namespace tunum
+{
+    // fmpintを遅延評価式のオペランドとする
+    template <TuFmpIntegral T>
+    constexpr fmpint_expr::operand<T> lazy(const T& v) noexcept
+    { return {v}; }
+}
+
+#endif
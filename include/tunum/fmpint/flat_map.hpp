@@ -0,0 +1,223 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_FLAT_MAP_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_FLAT_MAP_HPP
+
+#include <bit>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include TUNUM_COMMON_INCLUDE(fmpint/hash.hpp)
+#include TUNUM_COMMON_INCLUDE(fmpint/impl/words.hpp)
+
+namespace tunum
+{
+    // 符号なしfmpintをキーとする、オープンアドレス法(線形探索)のハッシュマップ
+    // キーは64bit単位の配列として連続した領域に格納し、比較は分岐を含まない要素ごとの比較で行う
+    // 探索開始位置は下位64bitのみから算出するため、下位64bitが等しいキーが多い場合は性能が劣化する
+    // 削除時は後続の要素を詰めなおすため、削除済みの目印は残らない
+    // @tparam Bytes キーのバイト数
+    // @tparam V 値の型(デフォルト構築、ムーブ代入可能なこと)
+    template <std::size_t Bytes, class V>
+    class fmpint_flat_map
+    {
+    public:
+        using key_type = fmpint<Bytes, false>;
+        using mapped_type = V;
+
+    private:
+        using words_t = _fmpint_impl::words_t<key_type>;
+
+        // 容量の最小値
+        static constexpr std::size_t min_capacity = 16;
+        // 負荷率の上限(max_load_num / max_load_den)
+        static constexpr std::size_t max_load_num = 7;
+        static constexpr std::size_t max_load_den = 8;
+        static constexpr std::size_t npos = ~std::size_t{};
+
+        std::vector<words_t> keys = {};
+        std::vector<V> values = {};
+        std::vector<std::uint8_t> is_used = {};
+        std::size_t count = 0;
+
+    public:
+        // -------------------------------------------
+        // コンストラクタ
+        // -------------------------------------------
+
+        constexpr fmpint_flat_map() = default;
+
+        // 少なくともn要素を再配置なしで格納可能な状態で生成
+        constexpr explicit fmpint_flat_map(std::size_t n)
+        { reserve(n); }
+
+        // -------------------------------------------
+        // 容量
+        // -------------------------------------------
+
+        constexpr std::size_t size() const noexcept
+        { return count; }
+
+        constexpr bool empty() const noexcept
+        { return count == 0; }
+
+        constexpr std::size_t capacity() const noexcept
+        { return keys.size(); }
+
+        // 少なくともn要素を再配置なしで格納可能とする
+        constexpr void reserve(std::size_t n)
+        {
+            const auto required = (std::max)(std::bit_ceil(n * max_load_den / max_load_num + 1), min_capacity);
+            if (required > capacity())
+                rehash(required);
+        }
+
+        // 全要素を削除(容量は維持する)
+        constexpr void clear()
+        {
+            for (std::size_t i = 0; i < capacity(); i++)
+                if (is_used[i]) {
+                    is_used[i] = 0;
+                    values[i] = V{};
+                }
+            count = 0;
+        }
+
+        // -------------------------------------------
+        // 検索
+        // -------------------------------------------
+
+        // キーに対応する値を取得(存在しない場合はnullptr)
+        constexpr V* find(const key_type& key)
+        {
+            const auto i = find_slot(_fmpint_impl::to_words(key));
+            return i != npos ? &values[i] : nullptr;
+        }
+        constexpr const V* find(const key_type& key) const
+        {
+            const auto i = find_slot(_fmpint_impl::to_words(key));
+            return i != npos ? &values[i] : nullptr;
+        }
+
+        constexpr bool contains(const key_type& key) const
+        { return find_slot(_fmpint_impl::to_words(key)) != npos; }
+
+        // キーに対応する値を取得(存在しない場合は例外を送出)
+        constexpr V& at(const key_type& key)
+        {
+            if (const auto v = find(key))
+                return *v;
+            throw std::out_of_range("The key is not found.");
+        }
+        constexpr const V& at(const key_type& key) const
+        {
+            if (const auto v = find(key))
+                return *v;
+            throw std::out_of_range("The key is not found.");
+        }
+
+        // -------------------------------------------
+        // 変更
+        // -------------------------------------------
+
+        // キーが存在しない場合のみ、argsから値を構築して挿入
+        // @return 値へのポインタと、挿入したかどうか
+        template <class... Args>
+        constexpr std::pair<V*, bool> try_emplace(const key_type& key, Args&&... args)
+        {
+            const auto words = _fmpint_impl::to_words(key);
+            if (const auto i = find_slot(words); i != npos)
+                return {&values[i], false};
+
+            reserve(count + 1);
+            const auto i = insert_slot(words);
+            values[i] = V(std::forward<Args>(args)...);
+            count++;
+            return {&values[i], true};
+        }
+
+        // キーに対応する値を取得(存在しない場合はデフォルト構築した値を挿入)
+        constexpr V& operator[](const key_type& key)
+        { return *try_emplace(key).first; }
+
+        // キーに対応する要素を削除
+        // @return 削除したかどうか
+        constexpr bool erase(const key_type& key)
+        {
+            auto i = find_slot(_fmpint_impl::to_words(key));
+            if (i == npos)
+                return false;
+
+            // 後続の要素のうち、本来の位置が空いた位置以前のものを詰める
+            const auto mask = capacity() - 1;
+            for (auto j = (i + 1) & mask; is_used[j]; j = (j + 1) & mask) {
+                const auto home = hash(keys[j]) & mask;
+                if (((j - home) & mask) >= ((j - i) & mask)) {
+                    keys[i] = keys[j];
+                    values[i] = std::move(values[j]);
+                    i = j;
+                }
+            }
+            is_used[i] = 0;
+            values[i] = V{};
+            count--;
+            return true;
+        }
+
+        // 全要素に対して関数を呼び出す(順序は不定)
+        // @param f (key_type, V&)を引数とする関数
+        template <class F>
+        constexpr void for_each(F&& f)
+        {
+            for (std::size_t i = 0; i < capacity(); i++)
+                if (is_used[i])
+                    f(_fmpint_impl::from_words<key_type>(keys[i]), values[i]);
+        }
+        template <class F>
+        constexpr void for_each(F&& f) const
+        {
+            for (std::size_t i = 0; i < capacity(); i++)
+                if (is_used[i])
+                    f(_fmpint_impl::from_words<key_type>(keys[i]), values[i]);
+        }
+
+    private:
+        // 探索開始位置の算出には下位64bitのみ使用する
+        static constexpr std::size_t hash(const words_t& words) noexcept
+        { return static_cast<std::size_t>(hash_mix(words[0])); }
+
+        // キーの格納位置を検索(存在しない場合はnpos)
+        constexpr std::size_t find_slot(const words_t& words) const noexcept
+        {
+            if (count == 0)
+                return npos;
+            const auto mask = capacity() - 1;
+            for (auto i = hash(words) & mask; is_used[i]; i = (i + 1) & mask)
+                if (_fmpint_impl::equal_words(keys[i], words))
+                    return i;
+            return npos;
+        }
+
+        // 存在しないキーを格納し、その位置を返却
+        constexpr std::size_t insert_slot(const words_t& words) noexcept
+        {
+            const auto mask = capacity() - 1;
+            auto i = hash(words) & mask;
+            while (is_used[i])
+                i = (i + 1) & mask;
+            keys[i] = words;
+            is_used[i] = 1;
+            return i;
+        }
+
+        constexpr void rehash(std::size_t new_capacity)
+        {
+            auto old_keys = std::exchange(keys, std::vector<words_t>(new_capacity));
+            auto old_values = std::exchange(values, std::vector<V>(new_capacity));
+            auto old_is_used = std::exchange(is_used, std::vector<std::uint8_t>(new_capacity));
+            for (std::size_t i = 0; i < old_keys.size(); i++)
+                if (old_is_used[i])
+                    values[insert_slot(old_keys[i])] = std::move(old_values[i]);
+        }
+    };
+}
+
+#endif
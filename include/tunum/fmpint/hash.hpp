@@ -0,0 +1,61 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_HASH_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_HASH_HPP
+
+#include <cstdint>
+#include <functional>
+#include TUNUM_COMMON_INCLUDE(fmpint/core.hpp)
+
+namespace tunum
+{
+    // -------------------------------------------
+    // ハッシュ値の算出
+    // 乗算とxorシフトで64bitずつ混ぜ合わせる
+    // -------------------------------------------
+
+    // 64bit値の各ビットを全体へ拡散する(splitmix64の最終段)
+    constexpr std::uint64_t hash_mix(std::uint64_t v) noexcept
+    {
+        v = (v ^ (v >> 30)) * 0xBF58476D'1CE4E5B9ull;
+        v = (v ^ (v >> 27)) * 0x94D049BB'133111EBull;
+        return v ^ (v >> 31);
+    }
+
+    // 既存のハッシュ値seedへ、別のハッシュ値vを結合
+    // seedへ奇数を乗算してから加算するため、結合の順序によって結果が異なる
+    constexpr std::size_t hash_combine(std::size_t seed, std::size_t v) noexcept
+    { return static_cast<std::size_t>(hash_mix(std::uint64_t{seed} * 0x9E3779B9'7F4A7C15ull + std::uint64_t{v})); }
+
+    // fmpintのハッシュ値
+    // 内部表現の要素を64bitずつ結合する(符号が同じであれば、サイズに依らず値が等しいものは同じハッシュ値となる)
+    template <std::size_t Bytes, bool Signed>
+    constexpr std::size_t hash_value(const fmpint<Bytes, Signed>& v) noexcept
+    {
+        using fmpint_t = fmpint<Bytes, Signed>;
+        // 符号拡張された上位の要素は、小さいサイズの同値と一致させるため読み飛ばす
+        // 残る最上位の要素の先頭ビットが符号と一致する場合のみ読み飛ばせる(一致しない場合は値の一部)
+        const bool is_minus = v._is_minus();
+        const auto extended = is_minus ? ~typename fmpint_t::base_data_t{} : typename fmpint_t::base_data_t{};
+        const auto top_bit = fmpint_t::base_data_digits2 - 1;
+        std::size_t length = fmpint_t::data_length;
+        while (length > 2 && v[length - 1] == extended && v[length - 2] == extended && (!Signed || bool(v[length - 3] >> top_bit) == is_minus))
+            length -= 2;
+
+        // 0の要素も位置に応じて異なるハッシュ値となるよう、初期値は0以外とする
+        std::size_t h = 0x9E3779B9'7F4A7C15ull;
+        for (std::size_t i = 0; i < length; i += 2)
+            h = hash_combine(h, static_cast<std::size_t>((std::uint64_t{v[i + 1]} << fmpint_t::base_data_digits2) | v[i]));
+        return h;
+    }
+}
+
+namespace std
+{
+    template <std::size_t Bytes, bool Signed>
+    struct hash<tunum::fmpint<Bytes, Signed>>
+    {
+        constexpr std::size_t operator()(const tunum::fmpint<Bytes, Signed>& v) const noexcept
+        { return tunum::hash_value(v); }
+    };
+}
+
+#endif
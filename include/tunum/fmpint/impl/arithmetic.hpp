@@ -1,7 +1,9 @@
 #ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_IMPL_ARITHMETIC_HPP
 #define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_IMPL_ARITHMETIC_HPP
 
+#include <bit>
 #include TUNUM_COMMON_INCLUDE(fmpint/impl/bit_operator.hpp)
+#include TUNUM_COMMON_INCLUDE(fmpint/impl/limb_mul.hpp)
 
 namespace tunum::_fmpint_impl
 {
@@ -21,8 +23,9 @@ namespace tunum::_fmpint_impl
         static constexpr auto max_digits2 = fi::max_digits2;
 
         // 左右オペランド
-        fi op_l;
-        fi op_r;
+        // コピーを避けるため参照で保持する(一時オブジェクトの場合、同一の完全式内でのみ使用すること)
+        const fi& op_l;
+        const fi& op_r;
 
         // 判定用
         bool is_zero_op_l_l;
@@ -61,6 +64,44 @@ namespace tunum::_fmpint_impl
         // 加算
         // ----------------------------
 
+        // dstへvを直接加算する
+        // lower, upperの順に再帰し、最小サイズでは組み込みの整数で桁上りを伝搬する
+        // @param carry 下位からの桁上り
+        // @return 最上位からの桁上り
+        static constexpr bool add_to(fi& dst, const fi& v, bool carry = false) noexcept
+        {
+            if constexpr (is_min_size) {
+                auto sum = std::uint64_t{dst.lower} + v.lower + carry;
+                dst.lower = static_cast<half_fi>(sum);
+                sum = std::uint64_t{dst.upper} + v.upper + (sum >> 32);
+                dst.upper = static_cast<half_fi>(sum);
+                return sum >> 32;
+            }
+            else {
+                using minor_arith = arithmetic<(size >> 1), false>;
+                return minor_arith::add_to(dst.upper, v.upper, minor_arith::add_to(dst.lower, v.lower, carry));
+            }
+        }
+
+        // dstからvを直接減算する
+        // @param borrow 下位からの桁借り
+        // @return 最上位からの桁借り
+        static constexpr bool sub_from(fi& dst, const fi& v, bool borrow = false) noexcept
+        {
+            if constexpr (is_min_size) {
+                const auto l = (std::uint64_t{dst.upper} << 32) | dst.lower;
+                const auto r = (std::uint64_t{v.upper} << 32) | v.lower;
+                const auto diff = l - r - borrow;
+                dst.lower = static_cast<half_fi>(diff);
+                dst.upper = static_cast<half_fi>(diff >> 32);
+                return l < r || (l == r && borrow);
+            }
+            else {
+                using minor_arith = arithmetic<(size >> 1), false>;
+                return minor_arith::sub_from(dst.upper, v.upper, minor_arith::sub_from(dst.lower, v.lower, borrow));
+            }
+        }
+
         // 加算
         // @param is_calculated_inv 桁上り判定用のビット反転が計算済みかどうか
         constexpr fi add(bool is_calculated_inv = false, const fi& inv_op_l = fi{}) const noexcept
@@ -98,8 +139,31 @@ namespace tunum::_fmpint_impl
         // ----------------------------
 
         // 乗算
-        // TODO: FFTによる高速化
-        constexpr double_fi mul() const noexcept { return mul_karatsuba(); }
+        // 符号ありの場合、中間値が符号拡張されないよう、内部表現はそのままに符号なしとして計算する
+        // 最小サイズの場合は組み込みの整数同士の乗算を組み合わせ、
+        // それ以外は32bit単位の配列とみなし、要素数に応じたアルゴリズム(mul_limbs参照)で計算する
+        constexpr double_fi mul() const noexcept
+        {
+            if constexpr (Signed)
+                return arithmetic<Bytes, false>{op_l._to_unsigned(), op_r._to_unsigned()}.mul()._switch_sign();
+            else if constexpr (is_min_size)
+                return mul_karatsuba();
+            else
+                return is_either_zero() ? double_fi{0} : mul_by_limbs();
+        }
+
+        // 32bit単位の配列としての乗算の実装
+        constexpr double_fi mul_by_limbs() const noexcept
+        {
+            using array_t = std::array<std::uint32_t, fi::data_length>;
+            const auto l = std::bit_cast<array_t>(op_l);
+            const auto r = std::bit_cast<array_t>(op_r);
+            const auto product = mul_limbs(l, r);
+
+            auto result = std::array<std::uint32_t, fi::data_length * 2>{};
+            std::copy(product.begin(), product.end(), result.begin());
+            return std::bit_cast<double_fi>(result);
+        }
 
         // カラツバ法による乗算の実装
         constexpr double_fi mul_karatsuba() const noexcept
@@ -152,6 +216,18 @@ namespace tunum::_fmpint_impl
             // 重いので計算せずとも自明なものはここではじいておく
             if (!op_r)
                 throw std::invalid_argument{"0 div."};
+
+            // 符号ありの場合は絶対値同士を符号なしとして除算し、組み込みの整数と同様に0方向へ丸める
+            if constexpr (Signed) {
+                const bool is_minus_l = op_l._is_minus();
+                const bool is_minus_r = op_r._is_minus();
+                const auto quo = fi{arithmetic<Bytes, false>{
+                    (is_minus_l ? -op_l : op_l)._to_unsigned(),
+                    (is_minus_r ? -op_r : op_r)._to_unsigned()
+                }.div()};
+                return (is_minus_l != is_minus_r) ? -quo : quo;
+            }
+
             if (!op_l || op_l < op_r)
                 return fi{};
             if (op_r == 1)
@@ -217,21 +293,25 @@ namespace tunum::_fmpint_impl
             const auto x = calc_reciprocal_by_newton(op_r, n, double_fi{1} << l_bit_width);
 
             // 分母の逆数の近似値と分子を乗算(桁上り考慮のため、_mulを使用)
-            const auto detect_result = major_arith{double_fi{op_l}, x}.mul() >> n;
-            const auto detect_inc = detect_result + 1;
-            // 1の誤差有無判定がてら結果返却
-            return op_l >= (detect_inc * op_r)
-                ? detect_inc
-                : detect_result;
+            auto detect_result = fi{major_arith{double_fi{op_l}, x}.mul() >> n};
+            // 逆数の近似値の誤差分を補正して結果返却
+            auto detect_mul = detect_result * op_r;
+            for (; op_l < detect_mul; detect_mul -= op_r)
+                --detect_result;
+            for (; op_l - detect_mul >= op_r; detect_mul += op_r)
+                ++detect_result;
+            return detect_result;
         }
 
         // ニュートン法による逆数の近似値xを算出
+        // 切り捨ての誤差により隣接する2値間で振動する場合があるため、その場合も打ち切る
         static constexpr auto calc_reciprocal_by_newton(const fi& q, const int n, const double_fi& init) noexcept
         {
             using major_arith = arithmetic<(size << 1), Signed>;
             auto x = init;
             const auto c2 = double_fi{2} << n;
-            for (auto m = double_fi{}; m != x;) {
+            for (auto m = double_fi{}, before_m = double_fi{}; m != x && before_m != x;) {
+                before_m = m;
                 m = x;
                 // 桁上り考慮のため_mulを使用
                 x = major_arith{x, c2 - q * x}.mul() >> n;
@@ -0,0 +1,80 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_IMPL_LIMB_DIV_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_IMPL_LIMB_DIV_HPP
+
+#include <bit>
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <utility>
+
+namespace tunum::_fmpint_impl
+{
+    // 32bit単位の配列(下位から格納)に対する除算
+    // Knuthのアルゴリズム D により、除数の上位2要素から商の1要素を推定し、必要な場合のみ補正する
+    // 除数は2要素以上、最上位の要素が0でないこと。被除数は除数以上の要素数であること
+    // @param quo 商の格納先(u.size() - v.size() + 1 要素、余りのみ必要な場合は空)
+    // @param rem 余りの格納先(v.size() 要素)
+    constexpr void divmod_limbs(std::span<const std::uint32_t> u, std::span<const std::uint32_t> v, std::span<std::uint32_t> quo, std::span<std::uint32_t> rem) noexcept
+    {
+        constexpr std::uint64_t b = std::uint64_t{1} << 32;
+        const auto m = u.size(), n = v.size();
+        const auto s = std::countl_zero(v[n - 1]);
+
+        // 除数の最上位ビットが1となるよう、両方を左シフトして正規化
+        const auto shift_l = [s](std::uint32_t hi, std::uint32_t lo) {
+            return static_cast<std::uint32_t>(s ? (hi << s) | (lo >> (32 - s)) : hi);
+        };
+        std::vector<std::uint32_t> vn(n), un(m + 1);
+        for (auto i = n - 1; i > 0; i--)
+            vn[i] = shift_l(v[i], v[i - 1]);
+        vn[0] = v[0] << s;
+        un[m] = s ? u[m - 1] >> (32 - s) : 0;
+        for (auto i = m - 1; i > 0; i--)
+            un[i] = shift_l(u[i], u[i - 1]);
+        un[0] = u[0] << s;
+
+        for (auto j = m - n + 1; j-- > 0;) {
+            // 商の推定
+            const auto num = (std::uint64_t{un[j + n]} << 32) | un[j + n - 1];
+            auto q_hat = num / vn[n - 1];
+            auto r_hat = num % vn[n - 1];
+            while (q_hat >= b || q_hat * vn[n - 2] > ((r_hat << 32) | un[j + n - 2])) {
+                q_hat--;
+                r_hat += vn[n - 1];
+                if (r_hat >= b)
+                    break;
+            }
+
+            // 推定した商と除数の積を減算
+            std::int64_t t = 0;
+            std::uint64_t k = 0;
+            for (std::size_t i = 0; i < n; i++) {
+                const auto p = q_hat * vn[i];
+                t = std::int64_t{un[i + j]} - static_cast<std::int64_t>(k) - static_cast<std::int64_t>(p & 0xFFFF'FFFF);
+                un[i + j] = static_cast<std::uint32_t>(t);
+                k = (p >> 32) - static_cast<std::uint64_t>(t >> 32);
+            }
+            t = std::int64_t{un[j + n]} - static_cast<std::int64_t>(k);
+            un[j + n] = static_cast<std::uint32_t>(t);
+
+            // 引きすぎた場合は除数を1回分加算して戻す
+            if (!quo.empty())
+                quo[j] = static_cast<std::uint32_t>(q_hat - (t < 0));
+            if (t < 0) {
+                std::uint64_t carry = 0;
+                for (std::size_t i = 0; i < n; i++) {
+                    carry += std::uint64_t{un[i + j]} + vn[i];
+                    un[i + j] = static_cast<std::uint32_t>(carry);
+                    carry >>= 32;
+                }
+                un[j + n] = static_cast<std::uint32_t>(un[j + n] + carry);
+            }
+        }
+
+        // 正規化を戻して余りとする
+        for (std::size_t i = 0; i < n; i++)
+            rem[i] = s ? (un[i] >> s) | (un[i + 1] << (32 - s)) : un[i];
+    }
+}
+
+#endif
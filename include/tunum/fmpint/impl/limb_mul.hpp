@@ -0,0 +1,402 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_IMPL_LIMB_MUL_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_IMPL_LIMB_MUL_HPP
+
+#include <span>
+#include <array>
+#include <compare>
+#include <vector>
+#include <cstdint>
+#include <numeric>
+#include <algorithm>
+#include TUNUM_COMMON_INCLUDE(fmpint/impl/ntt.hpp)
+
+namespace tunum::_fmpint_impl
+{
+    // ----------------------------------
+    // 32bit単位の配列(下位から格納)に対する乗算
+    // 要素数に応じて、筆算、カラツバ法、Toom-3、Toom-4、数論変換を使い分ける
+    // ----------------------------------
+
+    using limbs_t = std::vector<std::uint32_t>;
+
+    // 乗算のアルゴリズム
+    enum class mul_algorithm
+    {
+        schoolbook,
+        karatsuba,
+        toom3,
+        toom4,
+        ntt,
+    };
+
+    // 各アルゴリズムを使用する最小の要素数(mul_algorithm::karatsuba 以降の順)
+    // 値は各アルゴリズム単体の実行時間を要素数ごとに計測し、隣接するアルゴリズムと逆転する位置とした
+    inline constexpr std::array<std::size_t, 4> mul_thresholds = {48, 512, 768, 1536};
+
+    // 要素数より使用するアルゴリズムを選択
+    constexpr mul_algorithm select_mul_algorithm(std::size_t n) noexcept
+    {
+        return static_cast<mul_algorithm>(
+            std::count_if(mul_thresholds.begin(), mul_thresholds.end(), [n](std::size_t t) { return t <= n; })
+        );
+    }
+
+    // 上位の0を除去
+    constexpr void trim_limbs(limbs_t& a) noexcept
+    {
+        while (!a.empty() && !a.back())
+            a.pop_back();
+    }
+
+    // 上位の0を除いた範囲
+    constexpr std::span<const std::uint32_t> trimmed(std::span<const std::uint32_t> a) noexcept
+    {
+        auto n = a.size();
+        while (n && !a[n - 1])
+            n--;
+        return a.first(n);
+    }
+
+    // 指定位置以降へ加算
+    constexpr void add_limbs_at(limbs_t& acc, std::span<const std::uint32_t> v, std::size_t offset)
+    {
+        if (acc.size() < offset + v.size())
+            acc.resize(offset + v.size());
+        std::uint64_t carry = 0;
+        auto i = offset;
+        for (std::size_t j = 0; j < v.size(); i++, j++) {
+            carry += std::uint64_t{acc[i]} + v[j];
+            acc[i] = static_cast<std::uint32_t>(carry);
+            carry >>= 32;
+        }
+        for (; carry; i++) {
+            if (i == acc.size())
+                acc.push_back(0);
+            carry += acc[i];
+            acc[i] = static_cast<std::uint32_t>(carry);
+            carry >>= 32;
+        }
+    }
+
+    // 減算(acc >= v であること)
+    constexpr void sub_limbs(limbs_t& acc, std::span<const std::uint32_t> v) noexcept
+    {
+        std::uint64_t borrow = 0;
+        for (std::size_t i = 0; i < acc.size() && (i < v.size() || borrow); i++) {
+            const auto sub = (i < v.size() ? v[i] : 0) + borrow;
+            borrow = acc[i] < sub;
+            acc[i] = static_cast<std::uint32_t>(acc[i] - sub);
+        }
+        trim_limbs(acc);
+    }
+
+    // 大小比較
+    constexpr std::strong_ordering compare_limbs(std::span<const std::uint32_t> l, std::span<const std::uint32_t> r) noexcept
+    {
+        l = trimmed(l), r = trimmed(r);
+        if (l.size() != r.size())
+            return l.size() <=> r.size();
+        for (auto i = l.size(); i-- > 0;)
+            if (l[i] != r[i])
+                return l[i] <=> r[i];
+        return std::strong_ordering::equal;
+    }
+
+    // Toom-Cook法の評価、補間に用いる符号付きの多倍長整数
+    struct signed_limbs
+    {
+        // 絶対値
+        limbs_t mag = {};
+        bool is_minus = false;
+
+        constexpr signed_limbs& operator+=(const signed_limbs& v)
+        {
+            if (is_minus == v.is_minus)
+                add_limbs_at(mag, v.mag, 0);
+            else if (compare_limbs(mag, v.mag) >= 0)
+                sub_limbs(mag, v.mag);
+            else {
+                auto r = v.mag;
+                sub_limbs(r, mag);
+                mag = std::move(r);
+                is_minus = v.is_minus;
+            }
+            is_minus &= !mag.empty();
+            return *this;
+        }
+
+        constexpr signed_limbs& operator-=(signed_limbs v)
+        {
+            v.is_minus = !v.is_minus && !v.mag.empty();
+            return *this += v;
+        }
+
+        // 整数倍
+        constexpr signed_limbs& operator*=(std::int64_t s)
+        {
+            const auto abs_s = static_cast<std::uint64_t>(s < 0 ? -s : s);
+            std::uint64_t carry = 0;
+            for (auto& v : mag) {
+                // |s| < 2^32 の範囲で使用
+                carry += v * abs_s;
+                v = static_cast<std::uint32_t>(carry);
+                carry >>= 32;
+            }
+            if (carry)
+                mag.push_back(static_cast<std::uint32_t>(carry));
+            if (!abs_s)
+                mag.clear();
+            is_minus = (is_minus != (s < 0)) && !mag.empty();
+            return *this;
+        }
+
+        // 割り切れることが分かっている整数での除算
+        constexpr signed_limbs& divexact(std::uint32_t d) noexcept
+        {
+            std::uint64_t rem = 0;
+            for (auto i = mag.size(); i-- > 0;) {
+                const auto cur = (rem << 32) | mag[i];
+                mag[i] = static_cast<std::uint32_t>(cur / d);
+                rem = cur % d;
+            }
+            trim_limbs(mag);
+            return *this;
+        }
+    };
+
+    constexpr limbs_t mul_limbs(std::span<const std::uint32_t> l, std::span<const std::uint32_t> r);
+
+    // 筆算
+    constexpr limbs_t mul_schoolbook(std::span<const std::uint32_t> l, std::span<const std::uint32_t> r)
+    {
+        auto result = limbs_t(l.size() + r.size());
+        for (std::size_t i = 0; i < l.size(); i++) {
+            std::uint64_t carry = 0;
+            for (std::size_t j = 0; j < r.size(); j++) {
+                carry += std::uint64_t{l[i]} * r[j] + result[i + j];
+                result[i + j] = static_cast<std::uint32_t>(carry);
+                carry >>= 32;
+            }
+            result[i + r.size()] = static_cast<std::uint32_t>(carry);
+        }
+        return result;
+    }
+
+    // カラツバ法
+    // l = l1 * X + l0, r = r1 * X + r0 としたとき、
+    // l * r = l1 * r1 * X^2 + ((l0 + l1)(r0 + r1) - l0 * r0 - l1 * r1) * X + l0 * r0
+    constexpr limbs_t mul_karatsuba(std::span<const std::uint32_t> l, std::span<const std::uint32_t> r)
+    {
+        const auto k = ((std::max)(l.size(), r.size()) + 1) / 2;
+        const auto split = [k](std::span<const std::uint32_t> a) {
+            const auto m = (std::min)(k, a.size());
+            return std::pair{a.first(m), a.subspan(m)};
+        };
+        const auto [l0, l1] = split(l);
+        const auto [r0, r1] = split(r);
+
+        auto z0 = mul_limbs(l0, r0);
+        auto z2 = mul_limbs(l1, r1);
+        auto l01 = limbs_t(l0.begin(), l0.end());
+        auto r01 = limbs_t(r0.begin(), r0.end());
+        add_limbs_at(l01, l1, 0);
+        add_limbs_at(r01, r1, 0);
+        auto z1 = mul_limbs(l01, r01);
+        sub_limbs(z1, z0);
+        sub_limbs(z1, z2);
+
+        auto result = limbs_t(l.size() + r.size());
+        add_limbs_at(result, z0, 0);
+        add_limbs_at(result, z1, k);
+        add_limbs_at(result, z2, k * 2);
+        result.resize(l.size() + r.size());
+        return result;
+    }
+
+    // ----------------------------------
+    // Toom-Cook法
+    // 各オペランドをK分割した多項式とみなし、0, 1, -1, 2, -2, 3, ... および無限遠点で評価した値同士を乗算する
+    // 積の多項式の係数は、評価点のヴァンデルモンド行列の逆行列(整数行列と公約数の組)により補間する
+    // 補間の最後に、公約数(Toom-3では6、Toom-4では120)で割り切れる除算を行う
+    // ----------------------------------
+
+    template <std::size_t K>
+    struct toom_cook
+    {
+        // 無限遠点を除く評価点の数(= 積の多項式のうち、最上位を除く係数の数)
+        static constexpr std::size_t point_count = K * 2 - 2;
+
+        // 評価点 0, 1, -1, 2, -2, ...
+        static constexpr auto points = []() {
+            std::array<std::int64_t, point_count> result{};
+            for (std::size_t i = 1; i < point_count; i++)
+                result[i] = (i % 2) ? std::int64_t(i / 2 + 1) : -std::int64_t(i / 2);
+            return result;
+        }();
+
+        // 有理数のまま求めた逆行列を、公約数と整数行列の組で表したもの
+        struct interpolation_matrix
+        {
+            std::int64_t denominator = 1;
+            std::array<std::array<std::int64_t, point_count>, point_count> numerator = {};
+        };
+
+        static constexpr auto matrix = []() {
+            // 分子, 分母の組の行列に対する、ガウス・ジョルダンの消去法
+            struct fraction { std::int64_t num, den; };
+            const auto normalize = [](fraction f) {
+                const auto g = std::gcd(f.num, f.den);
+                return (f.den < 0) ? fraction{-f.num / g, -f.den / g} : fraction{f.num / g, f.den / g};
+            };
+            const auto sub_mul = [&](fraction a, fraction b, fraction c) {
+                // a - b * c
+                return normalize({a.num * b.den * c.den - b.num * c.num * a.den, a.den * b.den * c.den});
+            };
+
+            std::array<std::array<fraction, point_count * 2>, point_count> m{};
+            for (std::size_t i = 0; i < point_count; i++) {
+                std::int64_t p = 1;
+                for (std::size_t j = 0; j < point_count; j++, p *= points[i])
+                    m[i][j] = {p, 1};
+                for (std::size_t j = 0; j < point_count; j++)
+                    m[i][point_count + j] = {i == j, 1};
+            }
+            for (std::size_t c = 0; c < point_count; c++) {
+                auto pivot = c;
+                while (m[pivot][c].num == 0)
+                    pivot++;
+                std::swap(m[c], m[pivot]);
+                const auto inv = normalize({m[c][c].den, m[c][c].num});
+                for (auto& v : m[c])
+                    v = normalize({v.num * inv.num, v.den * inv.den});
+                for (std::size_t i = 0; i < point_count; i++) {
+                    if (i == c || m[i][c].num == 0)
+                        continue;
+                    const auto factor = m[i][c];
+                    for (std::size_t j = 0; j < point_count * 2; j++)
+                        m[i][j] = sub_mul(m[i][j], factor, m[c][j]);
+                }
+            }
+
+            interpolation_matrix result{};
+            for (std::size_t i = 0; i < point_count; i++)
+                for (std::size_t j = 0; j < point_count; j++)
+                    result.denominator = std::lcm(result.denominator, m[i][point_count + j].den);
+            for (std::size_t i = 0; i < point_count; i++)
+                for (std::size_t j = 0; j < point_count; j++) {
+                    const auto& f = m[i][point_count + j];
+                    result.numerator[i][j] = f.num * (result.denominator / f.den);
+                }
+            return result;
+        }();
+
+        // 分割した各部分を係数とし、pで評価
+        static constexpr signed_limbs evaluate(const std::array<std::span<const std::uint32_t>, K>& parts, std::int64_t p)
+        {
+            // ホーナー法
+            auto result = signed_limbs{};
+            for (auto i = K; i-- > 0;) {
+                result *= p;
+                result += signed_limbs{limbs_t(parts[i].begin(), parts[i].end())};
+            }
+            return result;
+        }
+
+        static constexpr limbs_t mul(std::span<const std::uint32_t> l, std::span<const std::uint32_t> r)
+        {
+            const auto k = ((std::max)(l.size(), r.size()) + K - 1) / K;
+            const auto split = [k](std::span<const std::uint32_t> a) {
+                std::array<std::span<const std::uint32_t>, K> parts{};
+                for (std::size_t i = 0; i < K; i++) {
+                    const auto first = (std::min)(k * i, a.size());
+                    parts[i] = a.subspan(first, (std::min)(k, a.size() - first));
+                }
+                return parts;
+            };
+            const auto l_parts = split(l);
+            const auto r_parts = split(r);
+
+            // 無限遠点での値(最上位の係数)
+            const auto r_inf = mul_limbs(l_parts.back(), r_parts.back());
+
+            // 各評価点での値から、最上位の係数の寄与を除く
+            std::array<signed_limbs, point_count> values{};
+            for (std::size_t i = 0; i < point_count; i++) {
+                const auto p = points[i];
+                const auto l_v = evaluate(l_parts, p);
+                const auto r_v = evaluate(r_parts, p);
+                values[i].mag = mul_limbs(l_v.mag, r_v.mag);
+                trim_limbs(values[i].mag);
+                values[i].is_minus = (l_v.is_minus != r_v.is_minus) && !values[i].mag.empty();
+
+                std::int64_t p_pow = 1;
+                for (std::size_t j = 0; j < point_count; j++)
+                    p_pow *= p;
+                auto inf_term = signed_limbs{r_inf};
+                trim_limbs(inf_term.mag);
+                values[i] -= (inf_term *= p_pow);
+            }
+
+            // 補間して各係数を X^i の位置へ加算
+            auto result = limbs_t(l.size() + r.size());
+            for (std::size_t i = 0; i < point_count; i++) {
+                auto coefficient = signed_limbs{};
+                for (std::size_t j = 0; j < point_count; j++) {
+                    if (const auto n = matrix.numerator[i][j]) {
+                        auto term = values[j];
+                        coefficient += (term *= n);
+                    }
+                }
+                coefficient.divexact(static_cast<std::uint32_t>(matrix.denominator));
+                add_limbs_at(result, coefficient.mag, k * i);
+            }
+            add_limbs_at(result, r_inf, k * point_count);
+            result.resize(l.size() + r.size());
+            return result;
+        }
+    };
+
+    constexpr limbs_t mul_toom3(std::span<const std::uint32_t> l, std::span<const std::uint32_t> r)
+    { return toom_cook<3>::mul(l, r); }
+
+    constexpr limbs_t mul_toom4(std::span<const std::uint32_t> l, std::span<const std::uint32_t> r)
+    { return toom_cook<4>::mul(l, r); }
+
+    // 指定したアルゴリズムで乗算(再帰した先の乗算は要素数に応じて選択する)
+    constexpr limbs_t mul_limbs_with(mul_algorithm algorithm, std::span<const std::uint32_t> l, std::span<const std::uint32_t> r)
+    {
+        switch (algorithm) {
+            case mul_algorithm::karatsuba: return mul_karatsuba(l, r);
+            case mul_algorithm::toom3: return mul_toom3(l, r);
+            case mul_algorithm::toom4: return mul_toom4(l, r);
+            case mul_algorithm::ntt: return mul_ntt(l, r);
+            default: return mul_schoolbook(l, r);
+        }
+    }
+
+    // 乗算(結果の要素数は l.size() + r.size())
+    // 要素数の差が大きい場合は、長い方を短い方の要素数ごとに区切って乗算する
+    constexpr limbs_t mul_limbs(std::span<const std::uint32_t> l, std::span<const std::uint32_t> r)
+    {
+        const auto result_size = l.size() + r.size();
+        l = trimmed(l), r = trimmed(r);
+        if (l.size() < r.size())
+            std::swap(l, r);
+
+        auto result = limbs_t{};
+        if (r.empty())
+            result = limbs_t(result_size);
+        else if (const auto algorithm = select_mul_algorithm(r.size()); algorithm == mul_algorithm::schoolbook)
+            result = mul_schoolbook(l, r);
+        else if (l.size() >= r.size() * 2) {
+            for (std::size_t i = 0; i < l.size(); i += r.size())
+                add_limbs_at(result, mul_limbs(l.subspan(i, (std::min)(r.size(), l.size() - i)), r), i);
+        }
+        else
+            result = mul_limbs_with(algorithm, l, r);
+        result.resize(result_size);
+        return result;
+    }
+}
+
+#endif
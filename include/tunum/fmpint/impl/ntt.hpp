@@ -0,0 +1,164 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_IMPL_NTT_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_IMPL_NTT_HPP
+
+#include <bit>
+#include <span>
+#include <array>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <stdexcept>
+
+namespace tunum::_fmpint_impl
+{
+    // ----------------------------------
+    // 数論変換(NTT)による多倍長の乗算
+    // 32bitの配列を係数とみなして畳み込みを行う
+    // 3つの法で個別に畳み込みを行い、中国剰余定理(Garnerのアルゴリズム)で係数を復元する
+    // 係数の最大値は (2^32 - 1)^2 * 短い方の要素数 となるため、3つの法の積(約2^86.02)未満に収まる範囲で使用すること
+    // ----------------------------------
+
+    // 法と原始根
+    // いずれも p = c * 2^k + 1 の形の素数であり、長さ2^kまでの変換が可能
+    struct ntt_modulus
+    {
+        std::uint64_t p;
+        std::uint64_t g;
+    };
+    inline constexpr std::array<ntt_modulus, 3> ntt_moduli = {{
+        {998'244'353, 3},   // 119 * 2^23 + 1
+        {167'772'161, 3},   // 5 * 2^25 + 1
+        {469'762'049, 3},   // 7 * 2^26 + 1
+    }};
+
+    // 変換可能な最大の長さ(各法で共通)
+    // 結果の要素数が2^23以下のとき短い方の要素数は2^22以下となり、係数の最大値は 2^22 * (2^32 - 1)^2 < 2^86 に収まる
+    // 3つの法の積(約2^86.02)に対して余裕はほぼないため、法を変えずにこの値を増やしてはならない
+    inline constexpr std::size_t ntt_max_length = std::size_t{1} << 23;
+
+    // 2^22 * (2^32 - 1)^2 < m1 * m2 * m3 の確認
+    // 64bitに収めるため、 2^22 * ceil((2^32 - 1)^2 / m3) < m1 * m2 で判定する
+    static_assert([] {
+        constexpr auto max_product = std::uint64_t{0xFFFF'FFFF} * 0xFFFF'FFFF;
+        constexpr auto m3 = ntt_moduli[2].p;
+        return (ntt_max_length / 2) * ((max_product + m3 - 1) / m3) < ntt_moduli[0].p * ntt_moduli[1].p;
+    }());
+
+    // a^e mod p
+    constexpr std::uint64_t ntt_pow(std::uint64_t a, std::uint64_t e, std::uint64_t p) noexcept
+    {
+        std::uint64_t result = 1;
+        for (a %= p; e; e >>= 1, a = a * a % p)
+            if (e & 1)
+                result = result * a % p;
+        return result;
+    }
+
+    // 長さが2の累乗の配列に対し、その場で変換を行う
+    // 剰余算を定数による除算として最適化させるため、法はテンプレート引数で指定する
+    // @tparam I 使用する法の、ntt_moduli上の位置
+    // @param is_inverse 逆変換を行う場合true(要素数による除算も含む)
+    template <std::size_t I>
+    constexpr void ntt(std::vector<std::uint64_t>& a, bool is_inverse) noexcept
+    {
+        constexpr auto m = ntt_moduli[I];
+        const auto n = a.size();
+        // ビット反転順に並べ替え
+        for (std::size_t i = 1, j = 0; i < n; i++) {
+            auto bit = n >> 1;
+            for (; j & bit; bit >>= 1)
+                j ^= bit;
+            j |= bit;
+            if (i < j)
+                std::swap(a[i], a[j]);
+        }
+
+        // バタフライ演算
+        // 回転因子は最も長い段の分を事前に算出し、短い段では間引いて使用する
+        auto w_n = ntt_pow(m.g, (m.p - 1) / n, m.p);
+        if (is_inverse)
+            w_n = ntt_pow(w_n, m.p - 2, m.p);
+        std::vector<std::uint64_t> w(n / 2);
+        for (std::size_t j = 0, v = 1; j < n / 2; j++, v = v * w_n % m.p)
+            w[j] = v;
+
+        for (std::size_t len = 2; len <= n; len <<= 1) {
+            const auto half = len / 2, stride = n / len;
+            for (std::size_t i = 0; i < n; i += len) {
+                for (std::size_t j = 0; j < half; j++) {
+                    const auto u = a[i + j];
+                    const auto v = a[i + j + half] * w[j * stride] % m.p;
+                    a[i + j] = u + v < m.p ? u + v : u + v - m.p;
+                    a[i + j + half] = u >= v ? u - v : u + m.p - v;
+                }
+            }
+        }
+
+        if (is_inverse) {
+            const auto inv_n = ntt_pow(n, m.p - 2, m.p);
+            for (auto& v : a)
+                v = v * inv_n % m.p;
+        }
+    }
+
+    // 1つの法での畳み込み
+    template <std::size_t I>
+    constexpr std::vector<std::uint64_t> ntt_convolve(std::span<const std::uint32_t> l, std::span<const std::uint32_t> r, std::size_t n)
+    {
+        constexpr auto m = ntt_moduli[I];
+        std::vector<std::uint64_t> fl(n), fr(n);
+        for (std::size_t i = 0; i < l.size(); i++)
+            fl[i] = l[i] % m.p;
+        for (std::size_t i = 0; i < r.size(); i++)
+            fr[i] = r[i] % m.p;
+        ntt<I>(fl, false);
+        ntt<I>(fr, false);
+        for (std::size_t i = 0; i < n; i++)
+            fl[i] = fl[i] * fr[i] % m.p;
+        ntt<I>(fl, true);
+        return fl;
+    }
+
+    // 32bitの配列の指定位置へ、64bitの値を加算して桁上りを伝搬する(配列の範囲外への桁上りは捨てる)
+    constexpr void ntt_add_at(std::vector<std::uint32_t>& a, std::size_t i, std::uint64_t v) noexcept
+    {
+        for (; v && i < a.size(); i++) {
+            v += a[i];
+            a[i] = static_cast<std::uint32_t>(v);
+            v >>= 32;
+        }
+    }
+
+    // 32bit単位の配列同士の積(結果の要素数は l.size() + r.size())
+    constexpr std::vector<std::uint32_t> mul_ntt(std::span<const std::uint32_t> l, std::span<const std::uint32_t> r)
+    {
+        constexpr auto m1 = ntt_moduli[0].p, m2 = ntt_moduli[1].p, m3 = ntt_moduli[2].p;
+        constexpr auto m1_m2 = m1 * m2;
+        constexpr auto inv_m1_mod_m2 = ntt_pow(m1, m2 - 2, m2);
+        constexpr auto inv_m1_m2_mod_m3 = ntt_pow(m1_m2 % m3, m3 - 2, m3);
+
+        auto result = std::vector<std::uint32_t>(l.size() + r.size());
+        if (l.empty() || r.empty())
+            return result;
+        const auto n = std::bit_ceil(result.size());
+        if (n > ntt_max_length)
+            throw std::length_error("The operands are too long for the NTT.");
+        const auto c1 = ntt_convolve<0>(l, r, n);
+        const auto c2 = ntt_convolve<1>(l, r, n);
+        const auto c3 = ntt_convolve<2>(l, r, n);
+
+        // Garnerのアルゴリズムにより x = t1 + m1 * t2 + m1 * m2 * t3 の形で係数を復元し、i番目の桁へ加算
+        for (std::size_t i = 0; i + 1 < result.size(); i++) {
+            const auto t1 = c1[i];
+            const auto t2 = (c2[i] + m2 - t1 % m2) % m2 * inv_m1_mod_m2 % m2;
+            const auto x12 = t1 + m1 * t2;
+            const auto t3 = (c3[i] + m3 - x12 % m3) % m3 * inv_m1_m2_mod_m3 % m3;
+            ntt_add_at(result, i, x12);
+            ntt_add_at(result, i, t3 * (m1_m2 & 0xFFFF'FFFF));
+            ntt_add_at(result, i + 1, t3 * (m1_m2 >> 32));
+        }
+        return result;
+    }
+}
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_IMPL_SCALAR_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_IMPL_SCALAR_HPP
+
+#include <bit>
+#include <array>
+#include <limits>
+#include <concepts>
+#include <cstdint>
+#include <utility>
+
+namespace tunum::_fmpint_impl
+{
+    // ----------------------------------
+    // fmpintと組み込みの整数(1要素分)との演算
+    // 組み込みの整数をfmpintへ拡張せず、内部表現を32bit単位の配列として直接計算する
+    // 加減算は符号の有無によらず、内部表現のまま計算する
+    // ----------------------------------
+
+    template <class T>
+    using scalar_limbs_t = std::array<std::uint32_t, T::data_length>;
+
+    // 32bitに収まるか
+    constexpr bool is_single_limb(std::uint64_t v) noexcept
+    { return v <= (std::numeric_limits<std::uint32_t>::max)(); }
+
+    // 組み込みの整数の絶対値
+    constexpr std::uint64_t scalar_abs(std::integral auto v) noexcept
+    {
+        const auto u = static_cast<std::uint64_t>(v);
+        return (v < 0) ? std::uint64_t{} - u : u;
+    }
+
+    // 加算(桁上りが止まった時点で打ち切る)
+    template <class T>
+    constexpr T add_1(const T& l, std::uint64_t r) noexcept
+    {
+        auto limbs = std::bit_cast<scalar_limbs_t<T>>(l);
+        std::uint64_t carry = 0;
+        for (std::size_t i = 0; i < limbs.size() && (i < 2 || carry); i++) {
+            carry += std::uint64_t{limbs[i]} + (i < 2 ? static_cast<std::uint32_t>(r >> (i * 32)) : 0);
+            limbs[i] = static_cast<std::uint32_t>(carry);
+            carry >>= 32;
+        }
+        return std::bit_cast<T>(limbs);
+    }
+
+    // 減算(桁借りが止まった時点で打ち切る)
+    template <class T>
+    constexpr T sub_1(const T& l, std::uint64_t r) noexcept
+    {
+        auto limbs = std::bit_cast<scalar_limbs_t<T>>(l);
+        std::uint64_t borrow = 0;
+        for (std::size_t i = 0; i < limbs.size() && (i < 2 || borrow); i++) {
+            const auto sub = (i < 2 ? static_cast<std::uint32_t>(r >> (i * 32)) : 0) + borrow;
+            borrow = limbs[i] < sub;
+            limbs[i] = static_cast<std::uint32_t>(limbs[i] - sub);
+        }
+        return std::bit_cast<T>(limbs);
+    }
+
+    // l * m + a (桁あふれした部分は破棄)
+    template <class T>
+    constexpr T mul_add_1(const T& l, std::uint32_t m, std::uint32_t a) noexcept
+    {
+        auto limbs = std::bit_cast<scalar_limbs_t<T>>(l);
+        std::uint64_t carry = a;
+        for (auto& v : limbs) {
+            carry += std::uint64_t{v} * m;
+            v = static_cast<std::uint32_t>(carry);
+            carry >>= 32;
+        }
+        return std::bit_cast<T>(limbs);
+    }
+
+    // 乗算(桁あふれした部分は破棄)
+    template <class T>
+    constexpr T mul_1(const T& l, std::uint32_t m) noexcept
+    { return mul_add_1(l, m, 0); }
+
+    // 符号なしとしての除算
+    // @return 商と余り
+    template <class T>
+    constexpr std::pair<T, std::uint32_t> divmod_1(const T& l, std::uint32_t d) noexcept
+    {
+        auto limbs = std::bit_cast<scalar_limbs_t<T>>(l);
+        std::uint64_t rem = 0;
+        for (auto i = limbs.size(); i-- > 0;) {
+            const auto cur = (rem << 32) | limbs[i];
+            limbs[i] = static_cast<std::uint32_t>(cur / d);
+            rem = cur % d;
+        }
+        return {std::bit_cast<T>(limbs), static_cast<std::uint32_t>(rem)};
+    }
+}
+
+#endif
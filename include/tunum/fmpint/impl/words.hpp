@@ -0,0 +1,52 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_IMPL_WORDS_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_IMPL_WORDS_HPP
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include TUNUM_COMMON_INCLUDE(fmpint/core.hpp)
+
+namespace tunum::_fmpint_impl
+{
+    // ----------------------------------
+    // 内部表現を64bit単位の配列として扱う
+    // lower, upperの再帰を辿らずに全体を走査するため、コンテナ等の大量の比較に用いる
+    // ----------------------------------
+
+    template <class T>
+    using words_t = std::array<std::uint64_t, T::size / sizeof(std::uint64_t)>;
+
+    // 内部表現を下位から64bitずつ取得
+    template <std::size_t Bytes, bool Signed>
+    constexpr auto to_words(const fmpint<Bytes, Signed>& v) noexcept
+    { return std::bit_cast<words_t<fmpint<Bytes, Signed>>>(v); }
+
+    // 64bitずつの配列から生成
+    template <class T>
+    constexpr T from_words(const words_t<T>& words) noexcept
+    { return std::bit_cast<T>(words); }
+
+    // 等値比較(要素ごとの分岐を含まない)
+    template <std::size_t N>
+    constexpr bool equal_words(const std::array<std::uint64_t, N>& l, const std::array<std::uint64_t, N>& r) noexcept
+    {
+        std::uint64_t diff = 0;
+        for (std::size_t i = 0; i < N; i++)
+            diff |= l[i] ^ r[i];
+        return diff == 0;
+    }
+
+    // 符号なしとしての大小比較(要素ごとの分岐を含まない)
+    template <std::size_t N>
+    constexpr bool less_words(const std::array<std::uint64_t, N>& l, const std::array<std::uint64_t, N>& r) noexcept
+    {
+        bool is_less = false, is_equal = true;
+        for (std::size_t i = N; i-- > 0;) {
+            is_less |= is_equal & (l[i] < r[i]);
+            is_equal &= l[i] == r[i];
+        }
+        return is_less;
+    }
+}
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_LIMITS_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_LIMITS_HPP
+
+#include <limits>
+#include TUNUM_COMMON_INCLUDE(fmpint/operator.hpp)
+
+namespace std
+{
+    // -------------------------------------------
+    // fmpintの数値的な性質
+    // 組み込みの整数型に準拠
+    // -------------------------------------------
+
+    template <std::size_t Bytes, bool Signed>
+    class numeric_limits<tunum::fmpint<Bytes, Signed>>
+    {
+        using fmpint_t = tunum::fmpint<Bytes, Signed>;
+
+    public:
+        static constexpr bool is_specialized = true;
+        static constexpr bool is_signed = Signed;
+        static constexpr bool is_integer = true;
+        static constexpr bool is_exact = true;
+        static constexpr bool has_infinity = false;
+        static constexpr bool has_quiet_NaN = false;
+        static constexpr bool has_signaling_NaN = false;
+        static constexpr float_denorm_style has_denorm = denorm_absent;
+        static constexpr bool has_denorm_loss = false;
+        static constexpr float_round_style round_style = round_toward_zero;
+        static constexpr bool is_iec559 = false;
+        static constexpr bool is_bounded = true;
+        static constexpr bool is_modulo = !Signed;
+        // 符号ビットを除いたビット数
+        static constexpr int digits = static_cast<int>(fmpint_t::max_digits2) - Signed;
+        // 全ての値を表現可能な10進数の桁数(digits * log10(2)の切り捨て)
+        static constexpr int digits10 = static_cast<int>(digits * 301'029'995ull / 1'000'000'000ull);
+        static constexpr int max_digits10 = 0;
+        static constexpr int radix = 2;
+        static constexpr int min_exponent = 0;
+        static constexpr int min_exponent10 = 0;
+        static constexpr int max_exponent = 0;
+        static constexpr int max_exponent10 = 0;
+        // 0除算は例外を送出する
+        static constexpr bool traps = true;
+        static constexpr bool tinyness_before = false;
+
+        static constexpr fmpint_t min() noexcept
+        { return Signed ? fmpint_t{1} << (fmpint_t::max_digits2 - 1) : fmpint_t{}; }
+
+        static constexpr fmpint_t lowest() noexcept
+        { return min(); }
+
+        static constexpr fmpint_t max() noexcept
+        { return ~min(); }
+
+        static constexpr fmpint_t epsilon() noexcept
+        { return fmpint_t{}; }
+
+        static constexpr fmpint_t round_error() noexcept
+        { return fmpint_t{}; }
+
+        static constexpr fmpint_t infinity() noexcept
+        { return fmpint_t{}; }
+
+        static constexpr fmpint_t quiet_NaN() noexcept
+        { return fmpint_t{}; }
+
+        static constexpr fmpint_t signaling_NaN() noexcept
+        { return fmpint_t{}; }
+
+        static constexpr fmpint_t denorm_min() noexcept
+        { return fmpint_t{}; }
+    };
+}
+
+#endif
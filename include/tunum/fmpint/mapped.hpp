@@ -0,0 +1,379 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_MAPPED_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_MAPPED_HPP
+
+#include <bit>
+#include <span>
+#include <array>
+#include <vector>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <filesystem>
+#include <type_traits>
+#include TUNUM_COMMON_INCLUDE(fmpint/core.hpp)
+
+#if defined(_WIN32)
+// min/maxマクロ等がstd::numeric_limits<T>::max()等と衝突しないよう、必要な宣言のみ取り込む
+#ifndef NOMINMAX
+#define NOMINMAX
+#define TUNUM_FMPINT_MAPPED_UNDEF_NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#define TUNUM_FMPINT_MAPPED_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#ifdef TUNUM_FMPINT_MAPPED_UNDEF_NOMINMAX
+#undef NOMINMAX
+#undef TUNUM_FMPINT_MAPPED_UNDEF_NOMINMAX
+#endif
+#ifdef TUNUM_FMPINT_MAPPED_UNDEF_WIN32_LEAN_AND_MEAN
+#undef WIN32_LEAN_AND_MEAN
+#undef TUNUM_FMPINT_MAPPED_UNDEF_WIN32_LEAN_AND_MEAN
+#endif
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace tunum
+{
+    // -------------------------------------------
+    // fmpintの配列のファイル形式
+    // ヘッダ(32バイト、各整数はリトルエンディアン)の直後に、要素を内部表現のまま隙間なく格納する
+    //  0: マジックナンバー "TUNUMFMP"
+    //  8: バージョン(uint32)
+    // 12: 1要素のバイト数 sizeof(fmpint)(uint32)
+    // 16: 符号の有無(uint8)
+    // 17: 要素のエンディアン(uint8、0: リトル、1: ビッグ)
+    // 18: 予約(0埋め)
+    // 24: 要素数(uint64)
+    // 読み込みは変換を行わないため、書き込んだ環境とエンディアンが異なる場合は読み込めない
+    // -------------------------------------------
+
+    namespace _mapped_impl
+    {
+        inline constexpr std::array<char, 8> magic = {'T', 'U', 'N', 'U', 'M', 'F', 'M', 'P'};
+        inline constexpr std::uint32_t version = 1;
+        inline constexpr std::size_t header_size = 32;
+        inline constexpr std::uint8_t native_endian = std::endian::native == std::endian::little ? 0 : 1;
+
+        using header_t = std::array<char, header_size>;
+
+        constexpr void put_le(header_t& header, std::size_t offset, std::uint64_t v, std::size_t bytes) noexcept
+        {
+            for (std::size_t i = 0; i < bytes; i++)
+                header[offset + i] = static_cast<char>(static_cast<std::uint8_t>(v >> (i * 8)));
+        }
+
+        constexpr std::uint64_t get_le(const header_t& header, std::size_t offset, std::size_t bytes) noexcept
+        {
+            std::uint64_t v = 0;
+            for (std::size_t i = 0; i < bytes; i++)
+                v |= std::uint64_t{static_cast<std::uint8_t>(header[offset + i])} << (i * 8);
+            return v;
+        }
+
+        template <class T>
+        constexpr header_t make_header(std::uint64_t count) noexcept
+        {
+            auto header = header_t{};
+            std::copy(magic.begin(), magic.end(), header.begin());
+            put_le(header, 8, version, 4);
+            put_le(header, 12, sizeof(T), 4);
+            put_le(header, 16, !is_unsigned_v<T>, 1);
+            put_le(header, 17, native_endian, 1);
+            put_le(header, 24, count, 8);
+            return header;
+        }
+
+        // ヘッダを検証し、要素数を返す
+        template <class T>
+        std::size_t read_header(const std::byte* data, std::size_t file_size)
+        {
+            if (file_size < header_size)
+                throw std::runtime_error{"fmpint array file is too short."};
+            auto header = header_t{};
+            std::transform(data, data + header_size, header.begin(), [](std::byte v) { return static_cast<char>(v); });
+
+            if (!std::equal(magic.begin(), magic.end(), header.begin()))
+                throw std::runtime_error{"Not a fmpint array file."};
+            if (get_le(header, 8, 4) != version)
+                throw std::runtime_error{"Unsupported fmpint array file version."};
+            if (get_le(header, 12, 4) != sizeof(T) || get_le(header, 16, 1) != !is_unsigned_v<T>)
+                throw std::runtime_error{"fmpint array file element type mismatch."};
+            if (get_le(header, 17, 1) != native_endian)
+                throw std::runtime_error{"fmpint array file endianness mismatch."};
+
+            const auto count = get_le(header, 24, 8);
+            if (count > (file_size - header_size) / sizeof(T))
+                throw std::runtime_error{"fmpint array file is truncated."};
+            return static_cast<std::size_t>(count);
+        }
+
+        // 読み取り専用でファイル全体をメモリへマップする
+        struct file_view
+        {
+            const std::byte* data = nullptr;
+            std::size_t size = 0;
+
+            static file_view map(const std::filesystem::path& path)
+            {
+#if defined(_WIN32)
+                const auto file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+                if (file == INVALID_HANDLE_VALUE)
+                    throw std::runtime_error{"Cannot open fmpint array file."};
+                LARGE_INTEGER file_size;
+                if (!::GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+                    ::CloseHandle(file);
+                    throw std::runtime_error{"fmpint array file is too short."};
+                }
+                const auto mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                ::CloseHandle(file);
+                if (!mapping)
+                    throw std::runtime_error{"Cannot map fmpint array file."};
+                const auto p = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                ::CloseHandle(mapping);
+                if (!p)
+                    throw std::runtime_error{"Cannot map fmpint array file."};
+                return {static_cast<const std::byte*>(p), static_cast<std::size_t>(file_size.QuadPart)};
+#else
+                const auto fd = ::open(path.c_str(), O_RDONLY);
+                if (fd < 0)
+                    throw std::runtime_error{"Cannot open fmpint array file."};
+                struct stat st;
+                if (::fstat(fd, &st) != 0 || st.st_size == 0) {
+                    ::close(fd);
+                    throw std::runtime_error{"fmpint array file is too short."};
+                }
+                const auto p = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                ::close(fd);
+                if (p == MAP_FAILED)
+                    throw std::runtime_error{"Cannot map fmpint array file."};
+                return {static_cast<const std::byte*>(p), static_cast<std::size_t>(st.st_size)};
+#endif
+            }
+
+            void unmap() noexcept
+            {
+                if (!data)
+                    return;
+#if defined(_WIN32)
+                ::UnmapViewOfFile(data);
+#else
+                ::munmap(const_cast<std::byte*>(data), size);
+#endif
+                data = nullptr;
+                size = 0;
+            }
+        };
+    }
+
+    // ファイルへマップしたfmpintの配列(読み取り専用)
+    // 要素はファイル上の内部表現をそのまま参照するため、読み込み時に変換を行わない
+    // @tparam Bytes バイト数
+    // @tparam Signed 符号の有無
+    template <std::size_t Bytes, bool Signed = false>
+    class mapped_fmpint_array
+    {
+    public:
+        using value_type = fmpint<Bytes, Signed>;
+        using size_type = std::size_t;
+        using const_reference = const value_type&;
+        using const_pointer = const value_type*;
+        using const_iterator = const value_type*;
+        using iterator = const_iterator;
+
+        static_assert(std::is_trivially_copyable_v<value_type> && std::is_standard_layout_v<value_type>);
+
+    private:
+        _mapped_impl::file_view view = {};
+        size_type length = 0;
+
+    public:
+        constexpr mapped_fmpint_array() = default;
+
+        explicit mapped_fmpint_array(const std::filesystem::path& path)
+            : view(_mapped_impl::file_view::map(path))
+        {
+            try {
+                length = _mapped_impl::read_header<value_type>(view.data, view.size);
+            }
+            catch (...) {
+                view.unmap();
+                throw;
+            }
+        }
+
+        mapped_fmpint_array(const mapped_fmpint_array&) = delete;
+        mapped_fmpint_array& operator=(const mapped_fmpint_array&) = delete;
+
+        mapped_fmpint_array(mapped_fmpint_array&& v) noexcept
+            : view(std::exchange(v.view, {}))
+            , length(std::exchange(v.length, 0))
+        {}
+
+        mapped_fmpint_array& operator=(mapped_fmpint_array&& v) noexcept
+        {
+            if (this != &v) {
+                view.unmap();
+                view = std::exchange(v.view, {});
+                length = std::exchange(v.length, 0);
+            }
+            return *this;
+        }
+
+        ~mapped_fmpint_array()
+        { view.unmap(); }
+
+        // -------------------------------------------
+        // 参照
+        // -------------------------------------------
+
+        const_pointer data() const noexcept
+        { return view.data ? reinterpret_cast<const_pointer>(view.data + _mapped_impl::header_size) : nullptr; }
+
+        size_type size() const noexcept
+        { return length; }
+
+        bool empty() const noexcept
+        { return length == 0; }
+
+        const_iterator begin() const noexcept
+        { return data(); }
+
+        const_iterator end() const noexcept
+        { return data() + length; }
+
+        const_reference operator[](size_type i) const noexcept
+        { return data()[i]; }
+
+        const_reference at(size_type i) const
+        {
+            if (i >= length)
+                throw std::out_of_range{"Out of range."};
+            return data()[i];
+        }
+
+        std::span<const value_type> span() const noexcept
+        { return {data(), length}; }
+
+        operator std::span<const value_type>() const noexcept
+        { return span(); }
+    };
+
+    // fmpintの配列をファイルへ書き込む
+    // 要素は内部のバッファへ溜め、バッファが埋まるたびにまとめて書き込む
+    // 要素数はclose()(またはデストラクタ)の時点でヘッダへ書き込む
+    // @tparam Bytes バイト数
+    // @tparam Signed 符号の有無
+    template <std::size_t Bytes, bool Signed = false>
+    class fmpint_array_writer
+    {
+    public:
+        using value_type = fmpint<Bytes, Signed>;
+
+        static_assert(std::is_trivially_copyable_v<value_type> && std::is_standard_layout_v<value_type>);
+
+    private:
+        std::ofstream stream;
+        std::vector<value_type> buffer;
+        std::uint64_t count = 0;
+
+    public:
+        // @param buffer_length バッファの要素数
+        explicit fmpint_array_writer(const std::filesystem::path& path, std::size_t buffer_length = 4096)
+            : stream(path, std::ios::binary | std::ios::trunc)
+        {
+            if (!stream)
+                throw std::runtime_error{"Cannot open fmpint array file."};
+            buffer.reserve((std::max)(buffer_length, std::size_t{1}));
+            const auto header = _mapped_impl::make_header<value_type>(0);
+            stream.write(header.data(), header.size());
+        }
+
+        fmpint_array_writer(fmpint_array_writer&&) = default;
+
+        // 書き込み中のファイルは、バッファの書き出しとヘッダの更新を行ってから閉じる
+        fmpint_array_writer& operator=(fmpint_array_writer&& v)
+        {
+            if (this != &v) {
+                close();
+                stream = std::move(v.stream);
+                buffer = std::move(v.buffer);
+                count = std::exchange(v.count, 0);
+            }
+            return *this;
+        }
+
+        ~fmpint_array_writer()
+        {
+            try {
+                close();
+            }
+            catch (...) {}
+        }
+
+        // 書き込んだ要素数
+        std::uint64_t size() const noexcept
+        { return count; }
+
+        void push(const value_type& v)
+        {
+            buffer.push_back(v);
+            count++;
+            if (buffer.size() == buffer.capacity())
+                flush();
+        }
+
+        // バッファ以上の要素数はバッファを経由せず直接書き込む
+        void write(std::span<const value_type> values)
+        {
+            if (values.size() < buffer.capacity() - buffer.size()) {
+                buffer.insert(buffer.end(), values.begin(), values.end());
+                count += values.size();
+                return;
+            }
+            flush();
+            write_raw(values);
+            count += values.size();
+        }
+
+        void close()
+        {
+            if (!stream.is_open())
+                return;
+            flush();
+            const auto header = _mapped_impl::make_header<value_type>(count);
+            stream.seekp(0);
+            stream.write(header.data(), header.size());
+            stream.close();
+            if (!stream)
+                throw std::runtime_error{"Failed to write fmpint array file."};
+        }
+
+    private:
+        void flush()
+        {
+            write_raw(buffer);
+            buffer.clear();
+        }
+
+        void write_raw(std::span<const value_type> values)
+        {
+            if (values.empty())
+                return;
+            stream.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size_bytes()));
+            if (!stream)
+                throw std::runtime_error{"Failed to write fmpint array file."};
+        }
+    };
+}
+
+#endif
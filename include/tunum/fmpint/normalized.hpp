@@ -0,0 +1,250 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_NORMALIZED_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_NORMALIZED_HPP
+
+#include <bit>
+#include <span>
+#include <array>
+#include <compare>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include TUNUM_COMMON_INCLUDE(fmpint/operator.hpp)
+#include TUNUM_COMMON_INCLUDE(fmpint/impl/limb_div.hpp)
+
+namespace tunum
+{
+    // 最上位の0でない要素の位置を保持する、符号なしfmpintの対となる型
+    // 加減乗除、比較、シフトは0でない要素(有効な要素)のみを走査するため、計算量は型の大きさでなく値の大きさに比例する
+    // 有効な要素より上位の要素は常に0とする
+    // 桁あふれの扱いは fmpint<Bytes, false> と同じ
+    // @tparam Bytes バイト数
+    template <std::size_t Bytes>
+    class normalized_fmpint
+    {
+    public:
+        using base_data_t = std::uint32_t;
+        using fmpint_type = fmpint<Bytes, false>;
+
+        static constexpr std::size_t data_length = fmpint_type::data_length;
+        static constexpr std::size_t max_digits2 = fmpint_type::max_digits2;
+        static constexpr std::size_t base_data_digits2 = fmpint_type::base_data_digits2;
+
+    private:
+        // 下位から格納
+        std::array<base_data_t, data_length> data = {};
+        // 有効な要素数
+        std::size_t active = 0;
+
+    public:
+        // -------------------------------------------
+        // コンストラクタ
+        // -------------------------------------------
+
+        constexpr normalized_fmpint() = default;
+
+        constexpr normalized_fmpint(std::integral auto v) noexcept
+            : normalized_fmpint(fmpint_type{v})
+        {}
+
+        constexpr normalized_fmpint(const fmpint_type& v) noexcept
+            : data(std::bit_cast<std::array<base_data_t, data_length>>(v))
+        { normalize(data_length); }
+
+        // -------------------------------------------
+        // 変換、参照
+        // -------------------------------------------
+
+        constexpr fmpint_type to_fmpint() const noexcept
+        { return std::bit_cast<fmpint_type>(data); }
+
+        constexpr explicit operator fmpint_type() const noexcept
+        { return to_fmpint(); }
+
+        constexpr explicit operator bool() const noexcept
+        { return active != 0; }
+
+        constexpr bool operator!() const noexcept
+        { return active == 0; }
+
+        // 有効な要素数(最上位の0でない要素の位置 + 1)
+        constexpr std::size_t active_length() const noexcept
+        { return active; }
+
+        // 有効な要素
+        constexpr std::span<const base_data_t> limbs() const noexcept
+        { return std::span{data}.first(active); }
+
+        // -------------------------------------------
+        // 演算子オーバーロード
+        // -------------------------------------------
+
+        // 加算代入
+        constexpr normalized_fmpint& operator+=(const normalized_fmpint& v) noexcept
+        {
+            const auto n = (std::max)(active, v.active);
+            std::uint64_t carry = 0;
+            for (std::size_t i = 0; i < n; i++) {
+                carry += std::uint64_t{data[i]} + v.data[i];
+                data[i] = static_cast<base_data_t>(carry);
+                carry >>= base_data_digits2;
+            }
+            if (carry && n < data_length)
+                data[n] = 1;
+            normalize((std::min)(n + 1, data_length));
+            return *this;
+        }
+
+        // 減算代入
+        // 負となる場合は、有効な要素より上位も桁借りして全要素が有効となる
+        constexpr normalized_fmpint& operator-=(const normalized_fmpint& v) noexcept
+        {
+            const auto n = (std::max)(active, v.active);
+            std::uint64_t borrow = 0;
+            for (std::size_t i = 0; i < n; i++) {
+                const auto sub = std::uint64_t{v.data[i]} + borrow;
+                borrow = data[i] < sub;
+                data[i] = static_cast<base_data_t>(data[i] - sub);
+            }
+            if (borrow)
+                std::fill(data.begin() + n, data.end(), ~base_data_t{});
+            normalize(borrow ? data_length : n);
+            return *this;
+        }
+
+        // 乗算代入
+        constexpr normalized_fmpint& operator*=(const normalized_fmpint& v) noexcept
+        {
+            const auto product = _fmpint_impl::mul_limbs(limbs(), v.limbs());
+            const auto n = (std::min)(product.size(), data_length);
+            std::fill(data.begin(), data.begin() + active, 0);
+            std::copy_n(product.begin(), n, data.begin());
+            normalize(n);
+            return *this;
+        }
+
+        // 除算代入
+        constexpr normalized_fmpint& operator/=(const normalized_fmpint& v)
+        { return *this = divmod(v).first; }
+
+        // 剰余代入
+        constexpr normalized_fmpint& operator%=(const normalized_fmpint& v)
+        { return *this = divmod(v).second; }
+
+        // 左シフト
+        constexpr normalized_fmpint& operator<<=(std::size_t n) noexcept
+        {
+            if (!active)
+                return *this;
+            if (n >= max_digits2)
+                return *this = normalized_fmpint{};
+            const auto limb_shift = n / base_data_digits2, bit_shift = n % base_data_digits2;
+            const auto top = (std::min)(active + limb_shift + 1, data_length);
+            for (auto i = top; i-- > limb_shift;) {
+                const auto hi = (i - limb_shift < active) ? data[i - limb_shift] : 0;
+                const auto lo = (i - limb_shift > 0) ? data[i - limb_shift - 1] : 0;
+                data[i] = bit_shift ? (hi << bit_shift) | (lo >> (base_data_digits2 - bit_shift)) : hi;
+            }
+            std::fill(data.begin(), data.begin() + limb_shift, 0);
+            normalize(top);
+            return *this;
+        }
+
+        // 右シフト
+        constexpr normalized_fmpint& operator>>=(std::size_t n) noexcept
+        {
+            const auto limb_shift = n / base_data_digits2, bit_shift = n % base_data_digits2;
+            if (limb_shift >= active)
+                return *this = normalized_fmpint{};
+            const auto top = active - limb_shift;
+            for (std::size_t i = 0; i < top; i++) {
+                const auto lo = data[i + limb_shift];
+                const auto hi = (i + limb_shift + 1 < active) ? data[i + limb_shift + 1] : 0;
+                data[i] = bit_shift ? (lo >> bit_shift) | (hi << (base_data_digits2 - bit_shift)) : lo;
+            }
+            std::fill(data.begin() + top, data.begin() + active, 0);
+            normalize(top);
+            return *this;
+        }
+
+        friend constexpr normalized_fmpint operator+(normalized_fmpint l, const normalized_fmpint& r) noexcept
+        { return l += r; }
+
+        friend constexpr normalized_fmpint operator-(normalized_fmpint l, const normalized_fmpint& r) noexcept
+        { return l -= r; }
+
+        friend constexpr normalized_fmpint operator*(normalized_fmpint l, const normalized_fmpint& r) noexcept
+        { return l *= r; }
+
+        friend constexpr normalized_fmpint operator/(normalized_fmpint l, const normalized_fmpint& r)
+        { return l /= r; }
+
+        friend constexpr normalized_fmpint operator%(normalized_fmpint l, const normalized_fmpint& r)
+        { return l %= r; }
+
+        friend constexpr normalized_fmpint operator<<(normalized_fmpint l, std::size_t r) noexcept
+        { return l <<= r; }
+
+        friend constexpr normalized_fmpint operator>>(normalized_fmpint l, std::size_t r) noexcept
+        { return l >>= r; }
+
+        friend constexpr bool operator==(const normalized_fmpint& l, const normalized_fmpint& r) noexcept
+        { return l.active == r.active && std::equal(l.data.begin(), l.data.begin() + l.active, r.data.begin()); }
+
+        // 比較(有効な要素数が異なる場合は、要素を参照せずに決まる)
+        friend constexpr std::strong_ordering operator<=>(const normalized_fmpint& l, const normalized_fmpint& r) noexcept
+        {
+            if (l.active != r.active)
+                return l.active <=> r.active;
+            for (auto i = l.active; i-- > 0;)
+                if (l.data[i] != r.data[i])
+                    return l.data[i] <=> r.data[i];
+            return std::strong_ordering::equal;
+        }
+
+        // -------------------------------------------
+        // 除算
+        // -------------------------------------------
+
+        // 商と余り
+        constexpr std::pair<normalized_fmpint, normalized_fmpint> divmod(const normalized_fmpint& v) const
+        {
+            if (!v)
+                throw std::invalid_argument{"0 div."};
+            if (*this < v)
+                return {normalized_fmpint{}, *this};
+
+            auto quo = normalized_fmpint{}, rem = normalized_fmpint{};
+            if (v.active == 1) {
+                // 除数が1要素の場合
+                std::uint64_t r = 0;
+                for (auto i = active; i-- > 0;) {
+                    const auto cur = (r << base_data_digits2) | data[i];
+                    quo.data[i] = static_cast<base_data_t>(cur / v.data[0]);
+                    r = cur % v.data[0];
+                }
+                rem.data[0] = static_cast<base_data_t>(r);
+            }
+            else
+                _fmpint_impl::divmod_limbs(
+                    limbs(),
+                    v.limbs(),
+                    std::span{quo.data}.first(active - v.active + 1),
+                    std::span{rem.data}.first(v.active)
+                );
+            quo.normalize(active - v.active + 1);
+            rem.normalize(v.active);
+            return {quo, rem};
+        }
+
+    private:
+        // 先頭n要素のうち、最上位の0でない要素の位置より有効な要素数を更新
+        constexpr void normalize(std::size_t n) noexcept
+        {
+            while (n && !data[n - 1])
+                n--;
+            active = n;
+        }
+    };
+}
+
+#endif
@@ -16,6 +16,14 @@ namespace tunum
     constexpr auto op_name(T1 l, const T2&  r) { return arithmetc_operation_result_t<T1, T2>{l} op r; }
 #endif
 
+    // 交換可能な演算は、左辺が組み込みの整数の場合に左右を入れ替え、組み込みの整数をfmpintへ拡張せずに計算する
+#ifndef TUNUM_FUNC_MAKE_FMPINT_COMMUTATIVE_OPERATOR
+#define TUNUM_FUNC_MAKE_FMPINT_COMMUTATIVE_OPERATOR(op_name, op) template <TuFmpIntegral T1, TuIntegral T2> \
+    constexpr auto op_name(const T1& l, const T2& r) { return arithmetc_operation_result_t<T1, T2>{l} op r; } \
+    template <std::integral T1, TuFmpIntegral T2> \
+    constexpr auto op_name(T1 l, const T2&  r) { return arithmetc_operation_result_t<T1, T2>{r} op l; }
+#endif
+
     template <TuFmpIntegral T>
     constexpr auto operator<<(const T& l, std::size_t r) { return T{l} <<= r; }
 
@@ -39,13 +47,14 @@ namespace tunum
     constexpr bool operator==(const TuFmpIntegral auto& l, const TuIntegral auto& r) { return (l <=> r) == 0; }
     constexpr bool operator==(std::integral auto l, const TuFmpIntegral auto& r) { return (l <=> r) == 0; }
 
-    TUNUM_FUNC_MAKE_FMPINT_OPERATOR(operator+, +=)
+    TUNUM_FUNC_MAKE_FMPINT_COMMUTATIVE_OPERATOR(operator+, +=)
     TUNUM_FUNC_MAKE_FMPINT_OPERATOR(operator-, -=)
-    TUNUM_FUNC_MAKE_FMPINT_OPERATOR(operator*, *=)
+    TUNUM_FUNC_MAKE_FMPINT_COMMUTATIVE_OPERATOR(operator*, *=)
     TUNUM_FUNC_MAKE_FMPINT_OPERATOR(operator/, /=)
     TUNUM_FUNC_MAKE_FMPINT_OPERATOR(operator%, %=)
 
 #undef TUNUM_FUNC_MAKE_FMPINT_OPERATOR
+#undef TUNUM_FUNC_MAKE_FMPINT_COMMUTATIVE_OPERATOR
 }
 
 #endif
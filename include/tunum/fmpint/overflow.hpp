@@ -0,0 +1,242 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_OVERFLOW_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_OVERFLOW_HPP
+
+#include <bit>
+#include <array>
+#include <compare>
+#include <stdexcept>
+#include <algorithm>
+#include TUNUM_COMMON_INCLUDE(fmpint/limits.hpp)
+
+namespace tunum
+{
+    // ----------------------------------
+    // 桁あふれを検出する演算
+    // より大きい型へ拡張せず、桁上りの伝搬結果や積の上位の要素から桁あふれを判定する
+    // ----------------------------------
+
+    // 桁あふれした部分を破棄した値と、桁あふれの有無
+    template <class T>
+    struct overflow_result
+    {
+        T value;
+        bool overflow;
+    };
+
+    // 加算
+    // 符号なしは最上位からの桁上り、符号ありは同符号同士の加算で符号が変わった場合を桁あふれとする
+    template <std::size_t Bytes, bool Signed>
+    constexpr overflow_result<fmpint<Bytes, Signed>> add_overflow(const fmpint<Bytes, Signed>& l, const fmpint<Bytes, Signed>& r) noexcept
+    {
+        auto result = l;
+        const bool carry = _fmpint_impl::arithmetic<Bytes, Signed>::add_to(result, r);
+        if constexpr (Signed)
+            return {result, l._is_minus() == r._is_minus() && result._is_minus() != l._is_minus()};
+        else
+            return {result, carry};
+    }
+
+    // 減算
+    // 符号なしは最上位からの桁借り、符号ありは異符号同士の減算で左辺と符号が変わった場合を桁あふれとする
+    template <std::size_t Bytes, bool Signed>
+    constexpr overflow_result<fmpint<Bytes, Signed>> sub_overflow(const fmpint<Bytes, Signed>& l, const fmpint<Bytes, Signed>& r) noexcept
+    {
+        auto result = l;
+        const bool borrow = _fmpint_impl::arithmetic<Bytes, Signed>::sub_from(result, r);
+        if constexpr (Signed)
+            return {result, l._is_minus() != r._is_minus() && result._is_minus() != l._is_minus()};
+        else
+            return {result, borrow};
+    }
+
+    // 乗算
+    // 絶対値同士の積を32bit単位の配列として求め、型に収まらない上位の要素の有無で判定する
+    template <std::size_t Bytes, bool Signed>
+    constexpr overflow_result<fmpint<Bytes, Signed>> mul_overflow(const fmpint<Bytes, Signed>& l, const fmpint<Bytes, Signed>& r) noexcept
+    {
+        using fi = fmpint<Bytes, Signed>;
+        using unsigned_fi = fmpint<Bytes, false>;
+        using limbs_t = std::array<std::uint32_t, fi::data_length>;
+
+        const bool is_minus_l = l._is_minus(), is_minus_r = r._is_minus();
+        const auto abs_l = (is_minus_l ? -l : l)._to_unsigned();
+        const auto abs_r = (is_minus_r ? -r : r)._to_unsigned();
+        const auto product = _fmpint_impl::mul_limbs(std::bit_cast<limbs_t>(abs_l), std::bit_cast<limbs_t>(abs_r));
+
+        auto lower = limbs_t{};
+        std::copy_n(product.begin(), lower.size(), lower.begin());
+        const bool is_upper_used = std::any_of(product.begin() + lower.size(), product.end(), [](std::uint32_t v) { return v != 0; });
+        const auto abs_result = std::bit_cast<unsigned_fi>(lower);
+
+        if constexpr (Signed) {
+            // 負となる場合は -2^(N-1) まで、正となる場合は 2^(N-1) - 1 まで表現可能
+            const bool is_minus = is_minus_l != is_minus_r;
+            const auto limit = unsigned_fi{std::numeric_limits<fi>::max()} + unsigned_fi{is_minus ? 1u : 0u};
+            const auto result = fi{abs_result};
+            return {is_minus ? -result : result, is_upper_used || abs_result > limit};
+        }
+        else
+            return {abs_result, is_upper_used};
+    }
+
+    // ----------------------------------
+    // 桁あふれ時の動作を指定したfmpintのラッパー
+    // 加減乗除を桁あふれ検出付きで行い、
+    // saturating は表現可能な最大値、最小値へ丸め、checked は例外(std::overflow_error)を送出する
+    // ----------------------------------
+
+    namespace _overflow_impl
+    {
+        // 符号ありの最小値を-1で除算する場合のみ桁あふれする
+        template <class T>
+        constexpr bool is_div_overflow(const T& l, const T& r) noexcept
+        {
+            if constexpr (is_unsigned_v<T>)
+                return false;
+            else
+                return l == std::numeric_limits<T>::min() && r == -1;
+        }
+
+        // 桁あふれ時の値(演算結果の符号に応じた最大値または最小値)
+        template <class T>
+        constexpr T saturated_value(bool is_minus) noexcept
+        { return is_minus ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max(); }
+    }
+
+    template <TuFmpIntegral T>
+    struct saturating
+    {
+        T value = {};
+
+        constexpr saturating() = default;
+
+        constexpr saturating(const T& v) noexcept
+            : value(v)
+        {}
+
+        constexpr saturating(std::integral auto v) noexcept
+            : value(v)
+        {}
+
+        constexpr explicit operator T() const noexcept
+        { return value; }
+
+        constexpr saturating& operator+=(const saturating& v) noexcept
+        {
+            const auto [result, overflow] = add_overflow(value, v.value);
+            // 桁あふれは同符号同士でのみ発生するため、右辺の符号が結果の符号となる
+            value = overflow ? _overflow_impl::saturated_value<T>(is_unsigned_v<T> ? false : v.value._is_minus()) : result;
+            return *this;
+        }
+
+        constexpr saturating& operator-=(const saturating& v) noexcept
+        {
+            const auto [result, overflow] = sub_overflow(value, v.value);
+            // 符号なしは0未満、符号ありは左辺の符号方向へ桁あふれする
+            value = overflow ? _overflow_impl::saturated_value<T>(is_unsigned_v<T> ? true : value._is_minus()) : result;
+            return *this;
+        }
+
+        constexpr saturating& operator*=(const saturating& v) noexcept
+        {
+            const auto [result, overflow] = mul_overflow(value, v.value);
+            value = overflow ? _overflow_impl::saturated_value<T>(value._is_minus() != v.value._is_minus()) : result;
+            return *this;
+        }
+
+        constexpr saturating& operator/=(const saturating& v)
+        {
+            value = _overflow_impl::is_div_overflow(value, v.value) ? std::numeric_limits<T>::max() : value / v.value;
+            return *this;
+        }
+
+        friend constexpr saturating operator+(saturating l, const saturating& r) noexcept
+        { return l += r; }
+
+        friend constexpr saturating operator-(saturating l, const saturating& r) noexcept
+        { return l -= r; }
+
+        friend constexpr saturating operator*(saturating l, const saturating& r) noexcept
+        { return l *= r; }
+
+        friend constexpr saturating operator/(saturating l, const saturating& r)
+        { return l /= r; }
+
+        friend constexpr bool operator==(const saturating& l, const saturating& r) noexcept
+        { return l.value == r.value; }
+
+        friend constexpr auto operator<=>(const saturating& l, const saturating& r) noexcept
+        { return l.value <=> r.value; }
+    };
+
+    template <TuFmpIntegral T>
+    struct checked
+    {
+        T value = {};
+
+        constexpr checked() = default;
+
+        constexpr checked(const T& v) noexcept
+            : value(v)
+        {}
+
+        constexpr checked(std::integral auto v) noexcept
+            : value(v)
+        {}
+
+        constexpr explicit operator T() const noexcept
+        { return value; }
+
+        constexpr checked& operator+=(const checked& v)
+        { return assign(add_overflow(value, v.value)); }
+
+        constexpr checked& operator-=(const checked& v)
+        { return assign(sub_overflow(value, v.value)); }
+
+        constexpr checked& operator*=(const checked& v)
+        { return assign(mul_overflow(value, v.value)); }
+
+        constexpr checked& operator/=(const checked& v)
+        {
+            if (_overflow_impl::is_div_overflow(value, v.value))
+                throw std::overflow_error{"fmpint division overflow."};
+            value /= v.value;
+            return *this;
+        }
+
+        friend constexpr checked operator+(checked l, const checked& r)
+        { return l += r; }
+
+        friend constexpr checked operator-(checked l, const checked& r)
+        { return l -= r; }
+
+        friend constexpr checked operator*(checked l, const checked& r)
+        { return l *= r; }
+
+        friend constexpr checked operator/(checked l, const checked& r)
+        { return l /= r; }
+
+        friend constexpr bool operator==(const checked& l, const checked& r) noexcept
+        { return l.value == r.value; }
+
+        friend constexpr auto operator<=>(const checked& l, const checked& r) noexcept
+        { return l.value <=> r.value; }
+
+    private:
+        constexpr checked& assign(const overflow_result<T>& r)
+        {
+            if (r.overflow)
+                throw std::overflow_error{"fmpint arithmetic overflow."};
+            value = r.value;
+            return *this;
+        }
+    };
+
+    template <std::size_t Bytes, bool Signed>
+    saturating(fmpint<Bytes, Signed>) -> saturating<fmpint<Bytes, Signed>>;
+
+    template <std::size_t Bytes, bool Signed>
+    checked(fmpint<Bytes, Signed>) -> checked<fmpint<Bytes, Signed>>;
+}
+
+#endif
@@ -0,0 +1,183 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_PACKED_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_PACKED_HPP
+
+#include <bit>
+#include <array>
+#include <compare>
+#include <algorithm>
+#include TUNUM_COMMON_INCLUDE(fmpint/operator.hpp)
+
+namespace tunum
+{
+    // 2の累乗に切り上げず、指定バイト数を32bit単位に切り上げた大きさのみを占有する固定長整数
+    // fmpint<24> は内部的に32バイトを占有するが、packed_fmpint<24> は24バイトとなる
+    // 大量の値を格納する用途を想定し、加減乗算、比較は32bit単位の配列のまま計算する
+    // 除算はfmpintへ変換して計算する
+    // 値はビット数(data_length * 32)で桁あふれし、fmpintから生成する際は上位の桁を破棄する
+    // @tparam Bytes バイト数
+    // @tparam Signed 符号の有無
+    template <std::size_t Bytes, bool Signed = false>
+    requires (Bytes > 0)
+    struct packed_fmpint
+    {
+        // -------------------------------------------
+        // メンバ定義
+        // -------------------------------------------
+
+        using base_data_t = std::uint32_t;
+        // 同じバイト数のfmpint
+        using fmpint_type = fmpint<Bytes, Signed>;
+
+        static constexpr std::size_t data_length = alignment(Bytes, sizeof(base_data_t));
+        static constexpr std::size_t size = data_length * sizeof(base_data_t);
+        static constexpr std::size_t base_data_digits2 = std::numeric_limits<base_data_t>::digits;
+        static constexpr std::size_t max_digits2 = size * 8;
+
+        // 下位から格納
+        std::array<base_data_t, data_length> data = {};
+
+        // -------------------------------------------
+        // コンストラクタ
+        // -------------------------------------------
+
+        constexpr packed_fmpint() = default;
+
+        // 組み込みの整数から生成
+        constexpr packed_fmpint(std::integral auto v) noexcept
+            : packed_fmpint(fmpint_type{v})
+        {}
+
+        // fmpintから生成(格納できない上位の桁は破棄)
+        template <std::size_t N, bool S>
+        constexpr packed_fmpint(const fmpint<N, S>& v) noexcept
+        {
+            const auto words = std::bit_cast<std::array<base_data_t, fmpint_type::data_length>>(fmpint_type{v});
+            std::copy_n(words.begin(), data_length, data.begin());
+        }
+
+        // -------------------------------------------
+        // 変換
+        // -------------------------------------------
+
+        // fmpintへ変換(符号ありの場合は符号拡張する)
+        constexpr fmpint_type to_fmpint() const noexcept
+        {
+            auto words = std::array<base_data_t, fmpint_type::data_length>{};
+            std::copy(data.begin(), data.end(), words.begin());
+            if (is_minus())
+                std::fill(words.begin() + data_length, words.end(), ~base_data_t{});
+            return std::bit_cast<fmpint_type>(words);
+        }
+
+        constexpr explicit operator fmpint_type() const noexcept
+        { return to_fmpint(); }
+
+        constexpr explicit operator bool() const noexcept
+        { return std::any_of(data.begin(), data.end(), [](base_data_t v) { return v != 0; }); }
+
+        constexpr bool operator!() const noexcept
+        { return !static_cast<bool>(*this); }
+
+        // 負の値か
+        constexpr bool is_minus() const noexcept
+        {
+            if constexpr (Signed)
+                return data.back() >> (base_data_digits2 - 1);
+            else
+                return false;
+        }
+
+        // -------------------------------------------
+        // 演算子オーバーロード
+        // -------------------------------------------
+
+        // ビット反転
+        constexpr packed_fmpint operator~() const noexcept
+        {
+            auto result = *this;
+            for (auto& v : result.data)
+                v = ~v;
+            return result;
+        }
+
+        constexpr packed_fmpint operator+() const noexcept
+        { return *this; }
+
+        // 2 の補数を返却
+        constexpr packed_fmpint operator-() const noexcept
+        { return ~(*this) += packed_fmpint{1}; }
+
+        // 加算代入
+        constexpr packed_fmpint& operator+=(const packed_fmpint& v) noexcept
+        {
+            std::uint64_t carry = 0;
+            for (std::size_t i = 0; i < data_length; i++) {
+                carry += std::uint64_t{data[i]} + v.data[i];
+                data[i] = static_cast<base_data_t>(carry);
+                carry >>= base_data_digits2;
+            }
+            return *this;
+        }
+
+        // 減算代入
+        constexpr packed_fmpint& operator-=(const packed_fmpint& v) noexcept
+        {
+            std::uint64_t borrow = 0;
+            for (std::size_t i = 0; i < data_length; i++) {
+                const auto sub = std::uint64_t{v.data[i]} + borrow;
+                borrow = data[i] < sub;
+                data[i] = static_cast<base_data_t>(data[i] - sub);
+            }
+            return *this;
+        }
+
+        // 乗算代入(符号ありの場合も、内部表現を符号なしとして乗算した下位の桁が結果となる)
+        constexpr packed_fmpint& operator*=(const packed_fmpint& v) noexcept
+        {
+            const auto product = _fmpint_impl::mul_limbs(data, v.data);
+            std::copy_n(product.begin(), data_length, data.begin());
+            return *this;
+        }
+
+        // 除算代入
+        constexpr packed_fmpint& operator/=(const packed_fmpint& v)
+        { return *this = packed_fmpint{to_fmpint() / v.to_fmpint()}; }
+
+        // 剰余代入
+        constexpr packed_fmpint& operator%=(const packed_fmpint& v)
+        { return *this = packed_fmpint{to_fmpint() % v.to_fmpint()}; }
+
+        friend constexpr packed_fmpint operator+(packed_fmpint l, const packed_fmpint& r) noexcept
+        { return l += r; }
+
+        friend constexpr packed_fmpint operator-(packed_fmpint l, const packed_fmpint& r) noexcept
+        { return l -= r; }
+
+        friend constexpr packed_fmpint operator*(packed_fmpint l, const packed_fmpint& r) noexcept
+        { return l *= r; }
+
+        friend constexpr packed_fmpint operator/(packed_fmpint l, const packed_fmpint& r)
+        { return l /= r; }
+
+        friend constexpr packed_fmpint operator%(packed_fmpint l, const packed_fmpint& r)
+        { return l %= r; }
+
+        friend constexpr bool operator==(const packed_fmpint& l, const packed_fmpint& r) noexcept
+        { return l.data == r.data; }
+
+        // 比較
+        // 符号ありの場合は、最上位の要素の符号ビットを反転して符号なしとして比較する
+        friend constexpr std::strong_ordering operator<=>(const packed_fmpint& l, const packed_fmpint& r) noexcept
+        {
+            constexpr auto sign_bit = base_data_t{Signed} << (base_data_digits2 - 1);
+            if (const auto cmp = (l.data.back() ^ sign_bit) <=> (r.data.back() ^ sign_bit); cmp != 0)
+                return cmp;
+            for (auto i = data_length - 1; i-- > 0;)
+                if (l.data[i] != r.data[i])
+                    return l.data[i] <=> r.data[i];
+            return std::strong_ordering::equal;
+        }
+    };
+}
+
+#endif
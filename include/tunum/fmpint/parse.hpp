@@ -0,0 +1,285 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_PARSE_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_PARSE_HPP
+
+#include <bit>
+#include <span>
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <system_error>
+#include TUNUM_COMMON_INCLUDE(fmpint/core.hpp)
+
+namespace tunum
+{
+    // -------------------------------------------
+    // 区切り文字(改行、カンマ)で区切られた整数の文字列の一括変換
+    // 各トークンは前後の空白(スペース、タブ、CR)を除き、
+    // [+-]?(0[xX][0-9a-fA-F]+ | 0[bB][01]+ | [0-9]+) の形式とする
+    // 先頭の0は10進数として扱う(リテラルと異なり8進数とはみなさない)
+    // 変換に失敗した行は0を格納し、例外を送出せずに行番号とエラーを記録する
+    // -------------------------------------------
+
+    // 変換に失敗した行
+    struct parse_error
+    {
+        // 行番号(出力先の添字)
+        std::size_t row;
+        // std::errc::invalid_argument: 空、または数値でない文字を含む
+        // std::errc::result_out_of_range: 型で表現できない
+        std::errc ec;
+
+        friend constexpr bool operator==(const parse_error&, const parse_error&) = default;
+    };
+
+    struct parse_column_result
+    {
+        // 出力先へ書き込んだ要素数(変換に失敗した行を含む)
+        std::size_t rows = 0;
+        // 読み込んだ文字数(続きの入力はこの位置から再開する)
+        std::size_t consumed = 0;
+        std::vector<parse_error> errors;
+    };
+
+    namespace _parse_impl
+    {
+        inline constexpr std::uint64_t ones = 0x0101'0101'0101'0101ull;
+
+        // 8文字を1つの64bit値として読み込む(先頭の文字が最下位)
+        template <class CharT>
+        constexpr std::uint64_t load8(const CharT* p) noexcept
+        {
+            std::uint64_t v = 0;
+            for (std::size_t i = 0; i < 8; i++)
+                v |= std::uint64_t{static_cast<std::uint8_t>(p[i])} << (i * 8);
+            return v;
+        }
+
+        // 64bit値のいずれかのバイトがcと等しいか
+        constexpr bool has_byte(std::uint64_t v, std::uint8_t c) noexcept
+        {
+            const auto x = v ^ (ones * c);
+            return ((x - ones) & ~x & (ones * 0x80)) != 0;
+        }
+
+        // 8文字全てが10進数の数字か
+        constexpr bool is_eight_digits(std::uint64_t v) noexcept
+        { return ((v & (ones * 0xF0)) | (((v + ones * 0x06) & (ones * 0xF0)) >> 4)) == ones * 0x33; }
+
+        // 8文字の10進数の数字を数値へ変換(2桁、4桁、8桁の順にまとめる)
+        constexpr std::uint32_t parse_eight_digits(std::uint64_t v) noexcept
+        {
+            v = ((v & (ones * 0x0F)) * (1 + (10 << 8))) >> 8;
+            v = ((v & 0x00FF'00FF'00FF'00FFull) * (1 + (100 << 16))) >> 16;
+            v = ((v & 0x0000'FFFF'0000'FFFFull) * (1 + (10'000ull << 32))) >> 32;
+            return static_cast<std::uint32_t>(v);
+        }
+
+        // 数字の値(数字でない場合は-1)
+        template <class CharT>
+        constexpr int digit_value(CharT ch) noexcept
+        {
+            if (ch >= CharT('0') && ch <= CharT('9'))
+                return int(ch - CharT('0'));
+            if (ch >= CharT('a') && ch <= CharT('f'))
+                return int(ch - CharT('a') + 10);
+            if (ch >= CharT('A') && ch <= CharT('F'))
+                return int(ch - CharT('A') + 10);
+            return -1;
+        }
+
+        // 8文字の10進数の数字を変換
+        // @return 全て数字の場合はtrue
+        template <class CharT>
+        constexpr bool parse_eight(const CharT* p, std::uint32_t& value) noexcept
+        {
+            if constexpr (sizeof(CharT) == 1) {
+                const auto v = load8(p);
+                value = parse_eight_digits(v);
+                return is_eight_digits(v);
+            }
+            else {
+                value = 0;
+                for (std::size_t i = 0; i < 8; i++) {
+                    const auto d = digit_value(p[i]);
+                    if (d < 0 || d >= 10)
+                        return false;
+                    value = value * 10 + static_cast<std::uint32_t>(d);
+                }
+                return true;
+            }
+        }
+
+        template <class CharT>
+        constexpr bool is_delimiter(CharT ch) noexcept
+        { return ch == CharT('\n') || ch == CharT(','); }
+
+        template <class CharT>
+        constexpr bool is_space(CharT ch) noexcept
+        { return ch == CharT(' ') || ch == CharT('\t') || ch == CharT('\r'); }
+
+        // pos以降で最初の区切り文字の位置(存在しない場合は文字列長)
+        // 1バイトの文字型は8文字ずつ区切り文字の有無を判定する
+        template <class CharT, class Traits>
+        constexpr std::size_t find_delimiter(std::basic_string_view<CharT, Traits> text, std::size_t pos) noexcept
+        {
+            if constexpr (sizeof(CharT) == 1)
+                for (; pos + 8 <= text.size(); pos += 8)
+                    if (const auto v = load8(text.data() + pos); has_byte(v, '\n') || has_byte(v, ','))
+                        break;
+            for (; pos < text.size(); pos++)
+                if (is_delimiter(text[pos]))
+                    return pos;
+            return text.size();
+        }
+
+        // 32bit単位の配列(下位から格納)への l = l * m + a
+        // @return 桁あふれしない場合はtrue
+        template <std::size_t N>
+        constexpr bool mul_add(std::array<std::uint32_t, N>& limbs, std::size_t& active, std::uint32_t m, std::uint32_t a) noexcept
+        {
+            std::uint64_t carry = a;
+            for (std::size_t i = 0; i < active; i++) {
+                carry += std::uint64_t{limbs[i]} * m;
+                limbs[i] = static_cast<std::uint32_t>(carry);
+                carry >>= 32;
+            }
+            if (!carry)
+                return true;
+            if (active == N)
+                return false;
+            limbs[active++] = static_cast<std::uint32_t>(carry);
+            return true;
+        }
+
+        // 10進数の数字列を絶対値へ変換
+        template <std::size_t N, class CharT, class Traits>
+        constexpr std::errc parse_decimal(std::basic_string_view<CharT, Traits> digits, std::array<std::uint32_t, N>& limbs) noexcept
+        {
+            std::size_t active = 0;
+            bool overflow = false;
+
+            // 8の倍数に満たない先頭の桁
+            const auto head = digits.size() % 8;
+            std::uint32_t head_value = 0, head_base = 1;
+            for (std::size_t i = 0; i < head; i++) {
+                const auto d = digit_value(digits[i]);
+                if (d < 0 || d >= 10)
+                    return std::errc::invalid_argument;
+                head_value = head_value * 10 + static_cast<std::uint32_t>(d);
+                head_base *= 10;
+            }
+            if (head)
+                overflow = !mul_add(limbs, active, head_base, head_value);
+
+            // 8桁ずつ変換
+            for (auto i = head; i < digits.size(); i += 8) {
+                std::uint32_t v = 0;
+                if (!parse_eight(digits.data() + i, v))
+                    return std::errc::invalid_argument;
+                if (!overflow)
+                    overflow = !mul_add(limbs, active, 100'000'000, v);
+            }
+            return overflow ? std::errc::result_out_of_range : std::errc{};
+        }
+
+        // 2の累乗進数の数字列を絶対値へ変換
+        template <std::size_t Base, std::size_t N, class CharT, class Traits>
+        constexpr std::errc parse_power2(std::basic_string_view<CharT, Traits> digits, std::array<std::uint32_t, N>& limbs) noexcept
+        {
+            constexpr auto digit_bit_width = std::bit_width(Base - 1);
+            bool overflow = false;
+            for (std::size_t bit = 0, i = digits.size(); i-- > 0; bit += digit_bit_width) {
+                const auto d = digit_value(digits[i]);
+                if (d < 0 || static_cast<std::size_t>(d) >= Base)
+                    return std::errc::invalid_argument;
+                if (bit >= N * 32)
+                    overflow = overflow || d != 0;
+                else
+                    limbs[bit / 32] |= static_cast<std::uint32_t>(d) << (bit % 32);
+            }
+            return overflow ? std::errc::result_out_of_range : std::errc{};
+        }
+
+        // 1トークンの変換
+        template <class T, class CharT, class Traits>
+        constexpr std::errc parse_token(std::basic_string_view<CharT, Traits> token, T& out) noexcept
+        {
+            using limbs_t = std::array<std::uint32_t, T::data_length>;
+
+            while (!token.empty() && is_space(token.front()))
+                token.remove_prefix(1);
+            while (!token.empty() && is_space(token.back()))
+                token.remove_suffix(1);
+
+            bool is_minus = false;
+            if (!token.empty() && (token.front() == CharT('+') || token.front() == CharT('-'))) {
+                is_minus = token.front() == CharT('-');
+                token.remove_prefix(1);
+            }
+            if (is_minus && is_unsigned_v<T>)
+                return std::errc::invalid_argument;
+
+            std::size_t base = 10;
+            if (token.size() > 2 && token[0] == CharT('0')) {
+                if (token[1] == CharT('x') || token[1] == CharT('X'))
+                    base = 16;
+                else if (token[1] == CharT('b') || token[1] == CharT('B'))
+                    base = 2;
+                if (base != 10)
+                    token.remove_prefix(2);
+            }
+            if (token.empty())
+                return std::errc::invalid_argument;
+
+            auto limbs = limbs_t{};
+            const auto ec = base == 16 ? parse_power2<16>(token, limbs)
+                : base == 2 ? parse_power2<2>(token, limbs)
+                : parse_decimal(token, limbs);
+            if (ec != std::errc{})
+                return ec;
+
+            const auto abs_v = std::bit_cast<fmpint<T::size, false>>(limbs);
+            if constexpr (!is_unsigned_v<T>) {
+                // 負数は -2^(N-1) まで、正数は 2^(N-1) - 1 まで
+                constexpr auto limit = ~fmpint<T::size, false>{} >> 1;
+                if (abs_v > limit + static_cast<unsigned>(is_minus))
+                    return std::errc::result_out_of_range;
+            }
+            out = is_minus ? -T{abs_v} : T{abs_v};
+            return std::errc{};
+        }
+    }
+
+    // 区切り文字で区切られた整数の文字列を、出力先へ順に変換する
+    // 出力先が埋まった場合、または入力の終端で終了する
+    // 入力を分割して与える場合は、最後以外を is_last_chunk = false とすることで、
+    // 区切り文字で終わらない末尾のトークンを変換せずに残す(consumed 以降を次の入力の先頭へ含める)
+    // @param text 入力文字列
+    // @param out 出力先
+    // @param is_last_chunk 入力の終端を含むか
+    template <TuFmpIntegral T, class CharT, class Traits>
+    constexpr parse_column_result parse_column(std::basic_string_view<CharT, Traits> text, std::span<T> out, bool is_last_chunk = true)
+    {
+        auto result = parse_column_result{};
+        std::size_t pos = 0;
+        while (result.rows < out.size() && pos < text.size()) {
+            const auto end = _parse_impl::find_delimiter(text, pos);
+            if (end == text.size() && !is_last_chunk)
+                break;
+
+            auto& v = out[result.rows];
+            if (const auto ec = _parse_impl::parse_token(text.substr(pos, end - pos), v); ec != std::errc{}) {
+                v = T{};
+                result.errors.push_back({result.rows, ec});
+            }
+            result.rows++;
+            pos = (std::min)(end + 1, text.size());
+        }
+        result.consumed = pos;
+        return result;
+    }
+}
+
+#endif
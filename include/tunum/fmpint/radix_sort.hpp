@@ -0,0 +1,169 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_RADIX_SORT_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_RADIX_SORT_HPP
+
+#include <span>
+#include <array>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <algorithm>
+#include TUNUM_COMMON_INCLUDE(fmpint/impl/words.hpp)
+
+namespace tunum::_radix_sort_impl
+{
+    // 基数ソートの桁
+    // @tparam DigitBits 1桁のビット数
+    template <class T, std::size_t DigitBits>
+    struct digit
+    {
+        static constexpr std::size_t radix = std::size_t{1} << DigitBits;
+        static constexpr std::uint64_t mask = radix - 1;
+        // 桁数
+        static constexpr std::size_t count = T::max_digits2 / DigitBits;
+        // 最上位の桁
+        static constexpr std::size_t top = count - 1;
+
+        // 下位からd番目の桁を取得
+        // 符号ありの場合は符号ビットを反転し、負の値が先に並ぶようにする
+        static constexpr std::size_t get(const T& v, std::size_t d) noexcept
+        {
+            const auto words = _fmpint_impl::to_words(v);
+            const auto bit = d * DigitBits;
+            auto result = (words[bit / 64] >> (bit % 64)) & mask;
+            if constexpr (!is_unsigned_v<T>)
+                result ^= (d == top) * (radix >> 1);
+            return static_cast<std::size_t>(result);
+        }
+    };
+
+    // 計数ソートより比較によるソートの方が速い要素数
+    // 1桁の計数ソートは要素数に加えて基数分の走査を伴うため、要素数が少ない場合は基数分の走査が支配的となる
+    inline constexpr std::size_t comparison_sort_threshold = 64;
+
+    // 下位の桁から順に、桁ごとに安定な計数ソートを行う(LSD)
+    // 全要素の桁が等しい場合、その桁の並べ替えは行わない
+    // 要素数が基数より少ない場合は8bitの桁で、さらに少ない場合は比較によるソートで並べ替える
+    // (並べ替える桁より上位の桁は、全要素で等しいこと)
+    // @param values 並べ替え対象
+    // @param buffer valuesと同じ要素数の作業領域
+    // @param digit_count 下位から並べ替える桁数
+    // @param counts 各桁の出現数の作業領域(基数以上の要素数、呼び出し元で使い回す)
+    template <std::size_t DigitBits, class T>
+    constexpr void lsd(std::span<T> values, std::span<T> buffer, std::size_t digit_count, std::vector<std::size_t>& counts)
+    {
+        using digit_t = digit<T, DigitBits>;
+        if (values.size() < comparison_sort_threshold) {
+            std::sort(values.begin(), values.end());
+            return;
+        }
+        if constexpr (DigitBits > 8)
+            if (values.size() < digit_t::radix) {
+                lsd<8>(values, buffer, digit_count * (DigitBits / 8), counts);
+                return;
+            }
+
+        if (counts.size() < digit_t::radix)
+            counts.resize(digit_t::radix);
+        const auto counts_end = counts.begin() + digit_t::radix;
+        auto src = values, dst = buffer;
+        for (std::size_t d = 0; d < digit_count; d++) {
+            std::fill(counts.begin(), counts_end, 0);
+            for (const auto& v : src)
+                counts[digit_t::get(v, d)]++;
+            if (std::find(counts.begin(), counts_end, src.size()) != counts_end)
+                continue;
+
+            for (std::size_t i = 0, sum = 0; i < digit_t::radix; i++)
+                sum += std::exchange(counts[i], sum);
+            for (const auto& v : src)
+                dst[counts[digit_t::get(v, d)]++] = v;
+            std::swap(src, dst);
+        }
+        if (src.data() != values.data())
+            std::copy(src.begin(), src.end(), values.begin());
+    }
+
+    // 最上位の桁で区間を分割し、各区間の開始位置を返却(区間数 + 1要素)
+    template <std::size_t DigitBits, class T>
+    constexpr std::vector<std::size_t> partition_top(std::span<T> values, std::span<T> buffer)
+    {
+        using digit_t = digit<T, DigitBits>;
+        std::vector<std::size_t> offsets(digit_t::radix + 1);
+        for (const auto& v : values)
+            offsets[digit_t::get(v, digit_t::top) + 1]++;
+        for (std::size_t i = 1; i <= digit_t::radix; i++)
+            offsets[i] += offsets[i - 1];
+
+        auto heads = offsets;
+        for (const auto& v : values)
+            buffer[heads[digit_t::get(v, digit_t::top)]++] = v;
+        std::copy(buffer.begin(), buffer.end(), values.begin());
+        return offsets;
+    }
+}
+
+namespace tunum
+{
+    // fmpintの配列を基数ソートで昇順に並べ替える
+    // 比較を行わず、内部表現からDigitBitsずつ取り出した桁で計数ソートを繰り返す
+    // 符号ありの場合は、最上位の桁の符号ビットを反転して扱う
+    // 要素数と同じ大きさの作業領域を確保する
+    // @tparam DigitBits 1桁のビット数(8 または 16)
+    template <std::size_t DigitBits = 8, std::size_t Bytes, bool Signed, std::size_t Extent>
+    requires (DigitBits == 8 || DigitBits == 16)
+    constexpr void radix_sort(std::span<fmpint<Bytes, Signed>, Extent> values)
+    {
+        using value_t = fmpint<Bytes, Signed>;
+        using digit_t = _radix_sort_impl::digit<value_t, DigitBits>;
+        if (values.size() < 2)
+            return;
+        std::vector<value_t> buffer(values.size());
+        std::vector<std::size_t> counts{};
+        _radix_sort_impl::lsd<DigitBits>(std::span<value_t>{values}, std::span{buffer}, digit_t::count, counts);
+    }
+
+    // fmpintの配列を、最上位の桁で分割した区間ごとに複数スレッドで基数ソートする(MSD)
+    // 最上位の桁による分割のみ呼び出し元のスレッドで行い、残りの桁は区間ごとに並列でLSDの基数ソートを行う
+    // 値の分布が偏り、一つの区間に要素が集中する場合は並列化の効果が得られない
+    // @tparam DigitBits 1桁のビット数(8 または 16)
+    // @param thread_count 使用するスレッド数(0の場合はハードウェアの並列数)
+    template <std::size_t DigitBits = 8, std::size_t Bytes, bool Signed, std::size_t Extent>
+    requires (DigitBits == 8 || DigitBits == 16)
+    void radix_sort_parallel(std::span<fmpint<Bytes, Signed>, Extent> values, std::size_t thread_count = 0)
+    {
+        using value_t = fmpint<Bytes, Signed>;
+        using digit_t = _radix_sort_impl::digit<value_t, DigitBits>;
+        if (values.size() < 2)
+            return;
+        if (thread_count == 0)
+            thread_count = (std::max)(std::thread::hardware_concurrency(), 1u);
+
+        std::vector<value_t> buffer(values.size());
+        const auto offsets = _radix_sort_impl::partition_top<DigitBits>(std::span<value_t>{values}, std::span{buffer});
+
+        // 各スレッドは未処理の区間を先頭から順に取得する
+        // 出現数の作業領域はスレッドごとに1つ確保し、区間の間で使い回す
+        std::atomic<std::size_t> next_bucket = 0;
+        const auto worker = [&]() {
+            std::vector<std::size_t> counts{};
+            for (auto b = next_bucket++; b < digit_t::radix; b = next_bucket++) {
+                const auto first = offsets[b], length = offsets[b + 1] - first;
+                if (length > 1)
+                    _radix_sort_impl::lsd<DigitBits>(
+                        std::span<value_t>{values}.subspan(first, length),
+                        std::span{buffer}.subspan(first, length),
+                        digit_t::top,
+                        counts
+                    );
+            }
+        };
+
+        std::vector<std::jthread> threads{};
+        for (std::size_t i = 1; i < thread_count; i++)
+            threads.emplace_back(worker);
+        worker();
+    }
+}
+
+#endif
@@ -0,0 +1,214 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_REDUCE_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_REDUCE_HPP
+
+#include <span>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <stdexcept>
+#include <algorithm>
+#include <type_traits>
+#include TUNUM_COMMON_INCLUDE(fmpint/operator.hpp)
+
+namespace tunum::execution
+{
+    // ----------------------------------------------------------
+    // 集約の実行方法の指定
+    // std::execution の実行ポリシーは、処理系によっては並列アルゴリズムのライブラリ(TBB等)のリンクを要するため、
+    // 同名の独自の型で指定する
+    // ----------------------------------------------------------
+
+    struct sequenced_policy {};
+    struct parallel_policy {};
+    struct parallel_unsequenced_policy {};
+
+    inline constexpr sequenced_policy seq{};
+    inline constexpr parallel_policy par{};
+    inline constexpr parallel_unsequenced_policy par_unseq{};
+}
+
+namespace tunum::_reduce_impl
+{
+    // 1つのタスクで処理する要素数の最小値
+    inline constexpr std::size_t min_chunk_size = 1024;
+
+    template <class ExecutionPolicy>
+    inline constexpr bool is_execution_policy_v = std::is_same_v<ExecutionPolicy, execution::sequenced_policy>
+        || std::is_same_v<ExecutionPolicy, execution::parallel_policy>
+        || std::is_same_v<ExecutionPolicy, execution::parallel_unsequenced_policy>;
+
+    // 実行ポリシーが並列実行を許可しているか
+    template <class ExecutionPolicy>
+    inline constexpr bool is_parallel_v = !std::is_same_v<std::remove_cvref_t<ExecutionPolicy>, execution::sequenced_policy>;
+
+    // [0, size) を分割して集約する
+    // 並列実行時は、各スレッドが未処理の区間を1つずつ取得して部分結果を蓄積し、最後に部分結果同士を結合する
+    // 区間の大きさはスレッド数より十分多く分割されるよう決めるため、処理の早いスレッドが残りの区間を引き受ける
+    // @param identity 単位元
+    // @param accumulate (部分結果, 開始位置, 終了位置)を受け取り、区間の結果を部分結果へ蓄積する関数
+    // @param combine (部分結果, 部分結果)を受け取り、前者へ結合する関数
+    template <class ExecutionPolicy, class Acc, class AccumulateF, class CombineF>
+    Acc run(std::size_t size, const Acc& identity, AccumulateF accumulate, CombineF combine)
+    {
+        const std::size_t thread_count = (std::max)(std::thread::hardware_concurrency(), 1u);
+        if (!is_parallel_v<ExecutionPolicy> || thread_count == 1 || size < min_chunk_size * 2) {
+            auto result = identity;
+            accumulate(result, std::size_t{}, size);
+            return result;
+        }
+
+        const auto chunk_size = (std::max)(min_chunk_size, size / (thread_count * 8));
+        const auto worker_count = (std::min)(thread_count, (size + chunk_size - 1) / chunk_size);
+        std::vector<Acc> partials(worker_count, identity);
+        std::atomic<std::size_t> next_first = 0;
+        const auto worker = [&](std::size_t i) {
+            for (auto first = next_first.fetch_add(chunk_size); first < size; first = next_first.fetch_add(chunk_size))
+                accumulate(partials[i], first, (std::min)(first + chunk_size, size));
+        };
+
+        {
+            std::vector<std::jthread> threads{};
+            for (std::size_t i = 1; i < worker_count; i++)
+                threads.emplace_back(worker, i);
+            worker(0);
+        }
+
+        auto result = identity;
+        for (const auto& partial : partials)
+            combine(result, partial);
+        return result;
+    }
+
+    // acc += l * r
+    // 要素同士の積は、要素の型の2倍の大きさ(桁あふれしない)で1回だけ求め、その積のみ蓄積型へ拡張する
+    // 符号ありの場合は絶対値同士の積を求め、符号に応じて加算または減算する
+    template <class AccT, class T1, class T2>
+    constexpr void add_product(AccT& acc, const T1& l, const T2& r) noexcept
+    {
+        using op_t = arithmetc_operation_result_t<T1, T2>;
+        using unsigned_op_t = fmpint<op_t::size, false>;
+        using unsigned_acc_t = fmpint<AccT::size, false>;
+
+        const auto op_l = op_t{l}, op_r = op_t{r};
+        bool is_minus = false;
+        auto abs_l = unsigned_op_t{op_l._to_unsigned()}, abs_r = unsigned_op_t{op_r._to_unsigned()};
+        if constexpr (!is_unsigned_v<op_t>) {
+            is_minus = op_l._is_minus() != op_r._is_minus();
+            if (op_l._is_minus())
+                abs_l = unsigned_op_t{-op_l};
+            if (op_r._is_minus())
+                abs_r = unsigned_op_t{-op_r};
+        }
+
+        const auto product = AccT{unsigned_acc_t{_fmpint_impl::arithmetic<op_t::size, false>{abs_l, abs_r}.mul()}};
+        if (is_minus)
+            acc -= product;
+        else
+            acc += product;
+    }
+
+    // 積和の既定の蓄積型(要素同士の積の桁数に加え、和の桁上りを保持できるよう4倍の大きさ)
+    template <TuFmpIntegral T1, TuFmpIntegral T2>
+    using dot_accumulator_t = fmpint<
+        arithmetc_operation_result_t<T1, T2>::size * 4,
+        !is_unsigned_v<arithmetc_operation_result_t<T1, T2>>
+    >;
+}
+
+namespace tunum
+{
+    // ----------------------------------------------------------
+    // fmpintの配列に対する集約
+    // fmpint.hpp には含めないため、このヘッダを個別にインクルードする
+    // 実行ポリシーには tunum::execution::seq, par, par_unseq を指定する
+    // seq 以外の場合は複数スレッドで処理する(par_unseq は par と同じ扱い)
+    // 部分結果は要素より大きい蓄積型 Acc で保持し、最後に Acc として返却する
+    // ----------------------------------------------------------
+
+    // 総和
+    // 既定の蓄積型は要素の2倍の大きさとする(2^(要素のビット数)個までの総和で桁あふれしない)
+    // @tparam Acc 蓄積型
+    template <
+        class Acc = void,
+        class ExecutionPolicy,
+        TuFmpIntegral T,
+        std::size_t Extent,
+        class AccT = std::conditional_t<std::is_void_v<Acc>, fmpint<T::size * 2, !is_unsigned_v<T>>, Acc>
+    >
+    requires _reduce_impl::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    AccT reduce_sum(ExecutionPolicy&&, std::span<T, Extent> values)
+    {
+        return _reduce_impl::run<ExecutionPolicy>(
+            values.size(),
+            AccT{},
+            [values](AccT& acc, std::size_t first, std::size_t last) {
+                for (auto i = first; i < last; i++)
+                    acc += AccT{values[i]};
+            },
+            [](AccT& acc, const AccT& partial) { acc += partial; }
+        );
+    }
+    template <class Acc = void, TuFmpIntegral T, std::size_t Extent>
+    auto reduce_sum(std::span<T, Extent> values)
+    { return reduce_sum<Acc>(execution::seq, values); }
+
+    // 総乗
+    // 既定の蓄積型は要素と同じ型とし、組み込みの整数と同様に桁あふれした部分は切り捨てる
+    // @tparam Acc 蓄積型
+    template <
+        class Acc = void,
+        class ExecutionPolicy,
+        TuFmpIntegral T,
+        std::size_t Extent,
+        class AccT = std::conditional_t<std::is_void_v<Acc>, std::remove_cv_t<T>, Acc>
+    >
+    requires _reduce_impl::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    AccT reduce_product(ExecutionPolicy&&, std::span<T, Extent> values)
+    {
+        return _reduce_impl::run<ExecutionPolicy>(
+            values.size(),
+            AccT{1},
+            [values](AccT& acc, std::size_t first, std::size_t last) {
+                for (auto i = first; i < last; i++)
+                    acc *= AccT{values[i]};
+            },
+            [](AccT& acc, const AccT& partial) { acc *= partial; }
+        );
+    }
+    template <class Acc = void, TuFmpIntegral T, std::size_t Extent>
+    auto reduce_product(std::span<T, Extent> values)
+    { return reduce_product<Acc>(execution::seq, values); }
+
+    // 内積
+    // 既定の蓄積型は要素の4倍の大きさとする(要素同士の積は桁あふれしない)
+    // @tparam Acc 蓄積型
+    template <
+        class Acc = void,
+        class ExecutionPolicy,
+        TuFmpIntegral T1,
+        std::size_t Extent1,
+        TuFmpIntegral T2,
+        std::size_t Extent2,
+        class AccT = std::conditional_t<std::is_void_v<Acc>, _reduce_impl::dot_accumulator_t<std::remove_cv_t<T1>, std::remove_cv_t<T2>>, Acc>
+    >
+    requires _reduce_impl::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicy>>
+    AccT dot(ExecutionPolicy&&, std::span<T1, Extent1> values1, std::span<T2, Extent2> values2)
+    {
+        if (values1.size() != values2.size())
+            throw std::invalid_argument("Sizes of the argument spans are different.");
+        return _reduce_impl::run<ExecutionPolicy>(
+            values1.size(),
+            AccT{},
+            [values1, values2](AccT& acc, std::size_t first, std::size_t last) {
+                for (auto i = first; i < last; i++)
+                    _reduce_impl::add_product(acc, values1[i], values2[i]);
+            },
+            [](AccT& acc, const AccT& partial) { acc += partial; }
+        );
+    }
+    template <class Acc = void, TuFmpIntegral T1, std::size_t Extent1, TuFmpIntegral T2, std::size_t Extent2>
+    auto dot(std::span<T1, Extent1> values1, std::span<T2, Extent2> values2)
+    { return dot<Acc>(execution::seq, values1, values2); }
+}
+
+#endif
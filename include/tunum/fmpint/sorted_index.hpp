@@ -0,0 +1,162 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_SORTED_INDEX_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_SORTED_INDEX_HPP
+
+#include <bit>
+#include <span>
+#include <array>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include TUNUM_COMMON_INCLUDE(fmpint/impl/words.hpp)
+
+namespace tunum
+{
+    // 符号なしfmpintの配列に対する、検索専用の整列済み索引
+    // 全てのキーに共通する上位のビットを除いた、上位の bucket_bits ビットで区間を分割しておき、
+    // 検索時は該当区間のみを分岐を含まない二分探索で調べる
+    // (小さい値のみを格納する場合も、区間がキーの分布する範囲に対して定まる)
+    // 構築後の要素の追加、削除はできない
+    // @tparam Bytes キーのバイト数
+    template <std::size_t Bytes>
+    class fmpint_sorted_index
+    {
+    public:
+        using key_type = fmpint<Bytes, false>;
+
+        // 見つからなかった場合の戻り値
+        static constexpr std::size_t npos = ~std::size_t{};
+        // 区間の分割に用いるビット数
+        static constexpr int bucket_bits = 8;
+
+    private:
+        using words_t = _fmpint_impl::words_t<key_type>;
+        static constexpr std::size_t bucket_count = std::size_t{1} << bucket_bits;
+
+        // 整列済みのキー
+        std::vector<words_t> keys = {};
+        // 整列済みのキーそれぞれの、構築元の配列での位置
+        std::vector<std::size_t> positions = {};
+        // 区間の分割に用いるビットの最下位の位置
+        std::size_t bucket_shift = 0;
+        // 区間ごとの開始位置
+        std::array<std::size_t, bucket_count + 1> offsets = {};
+
+    public:
+        constexpr fmpint_sorted_index() = default;
+
+        // 配列より索引を構築
+        // 重複したキーは、構築元の配列で先に現れた位置を検索結果とする
+        constexpr explicit fmpint_sorted_index(std::span<const key_type> source)
+            : keys(source.size())
+            , positions(source.size())
+        {
+            // 最小、最大のキーで異なる最上位のビットの直下までを区間の分割に用いる
+            // 全てのキーは最小と最大の間にあるため、それより上位のビットは共通となる
+            if (!source.empty()) {
+                const auto [min_key, max_key] = std::minmax_element(source.begin(), source.end());
+                const auto min_words = _fmpint_impl::to_words(*min_key), max_words = _fmpint_impl::to_words(*max_key);
+                for (std::size_t i = min_words.size(); i-- > 0;)
+                    if (const auto diff = min_words[i] ^ max_words[i]; diff) {
+                        const auto width = i * 64 + static_cast<std::size_t>(std::bit_width(diff));
+                        bucket_shift = width > bucket_bits ? width - bucket_bits : 0;
+                        break;
+                    }
+            }
+
+            // 区間の分割に用いるビットによる計数ソートで区間を分割
+            for (const auto& key : source)
+                offsets[bucket_of(_fmpint_impl::to_words(key)) + 1]++;
+            std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+            auto heads = offsets;
+            for (std::size_t i = 0; i < source.size(); i++) {
+                const auto words = _fmpint_impl::to_words(source[i]);
+                const auto j = heads[bucket_of(words)]++;
+                keys[j] = words;
+                positions[j] = i;
+            }
+
+            // 区間ごとに整列(等しいキーは構築元の順序とする)
+            std::vector<std::size_t> order{};
+            for (std::size_t b = 0; b < bucket_count; b++) {
+                const auto first = offsets[b], last = offsets[b + 1];
+                if (last - first < 2)
+                    continue;
+                order.resize(last - first);
+                std::iota(order.begin(), order.end(), first);
+                std::sort(order.begin(), order.end(), [this](std::size_t l, std::size_t r) {
+                    return _fmpint_impl::less_words(keys[l], keys[r])
+                        || (_fmpint_impl::equal_words(keys[l], keys[r]) && positions[l] < positions[r]);
+                });
+
+                std::vector<words_t> sorted_keys(order.size());
+                std::vector<std::size_t> sorted_positions(order.size());
+                for (std::size_t i = 0; i < order.size(); i++) {
+                    sorted_keys[i] = keys[order[i]];
+                    sorted_positions[i] = positions[order[i]];
+                }
+                std::copy(sorted_keys.begin(), sorted_keys.end(), keys.begin() + first);
+                std::copy(sorted_positions.begin(), sorted_positions.end(), positions.begin() + first);
+            }
+        }
+
+        constexpr std::size_t size() const noexcept
+        { return keys.size(); }
+
+        constexpr bool empty() const noexcept
+        { return keys.empty(); }
+
+        // キーより小さい要素の数
+        constexpr std::size_t lower_bound(const key_type& key) const noexcept
+        { return lower_bound_words(_fmpint_impl::to_words(key)); }
+
+        // キーの構築元の配列での位置を検索(存在しない場合はnpos)
+        constexpr std::size_t find(const key_type& key) const noexcept
+        {
+            const auto words = _fmpint_impl::to_words(key);
+            const auto i = lower_bound_words(words);
+            return i < size() && _fmpint_impl::equal_words(keys[i], words)
+                ? positions[i]
+                : npos;
+        }
+
+        constexpr bool contains(const key_type& key) const noexcept
+        { return find(key) != npos; }
+
+    private:
+        // 最小から最大のキーの範囲にある値のみを対象とする
+        constexpr std::size_t bucket_of(const words_t& words) const noexcept
+        {
+            const auto i = bucket_shift / 64, shift = bucket_shift % 64;
+            auto bits = words[i] >> shift;
+            if (shift > 64 - bucket_bits && i + 1 < words.size())
+                bits |= words[i + 1] << (64 - shift);
+            return static_cast<std::size_t>(bits & (bucket_count - 1));
+        }
+
+        // 該当区間のみを対象とした二分探索
+        // 比較結果を位置の加算に用いることで、分岐予測の失敗を避ける
+        constexpr std::size_t lower_bound_words(const words_t& words) const noexcept
+        {
+            // 範囲外のキーは区間を求められないため、先頭または末尾とする
+            if (empty() || !_fmpint_impl::less_words(keys.front(), words))
+                return 0;
+            if (_fmpint_impl::less_words(keys.back(), words))
+                return size();
+
+            const auto b = bucket_of(words);
+            auto base = offsets[b];
+            auto n = offsets[b + 1] - base;
+            if (n == 0)
+                return base;
+            while (n > 1) {
+                const auto half = n / 2;
+                base += _fmpint_impl::less_words(keys[base + half], words) * half;
+                n -= half;
+            }
+            return base + _fmpint_impl::less_words(keys[base], words);
+        }
+    };
+}
+
+#endif
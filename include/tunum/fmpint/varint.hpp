@@ -0,0 +1,156 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_VARINT_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_FMPINT_VARINT_HPP
+
+#include <span>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <algorithm>
+#include <type_traits>
+#include TUNUM_COMMON_INCLUDE(fmpint/bytes.hpp)
+
+namespace tunum
+{
+    // -------------------------------------------
+    // fmpintの可変長符号化
+    // 値を表現するのに必要なバイト数nを先頭に置き、続けて値の下位nバイトをリトルエンディアンで格納する
+    // nはLEB128で符号化する(128バイト未満の型では常に1バイト)
+    // 符号ありはジグザグ符号化(0, -1, 1, -2, ... を 0, 1, 2, 3, ... へ対応させる)により、絶対値の小さい負数も短くなる
+    // 復号はnを読んだ後にnバイトを複写するのみで、値の桁ごとの分岐を必要としない
+    // -------------------------------------------
+
+    namespace _varint_impl
+    {
+        template <class T>
+        using unsigned_t = fmpint<T::size, false>;
+
+        // LEB128で符号化したnのバイト数
+        constexpr std::size_t length_size(std::size_t n) noexcept
+        {
+            std::size_t size = 1;
+            for (; n >= 0x80; n >>= 7)
+                size++;
+            return size;
+        }
+
+        template <class T>
+        constexpr unsigned_t<T> zigzag(const T& v) noexcept
+        {
+            if constexpr (is_unsigned_v<T>)
+                return v;
+            else {
+                const auto u = v._to_unsigned() << 1;
+                return v._is_minus() ? ~u : u;
+            }
+        }
+
+        template <class T>
+        constexpr T unzigzag(const unsigned_t<T>& u) noexcept
+        {
+            if constexpr (is_unsigned_v<T>)
+                return u;
+            else {
+                const auto v = u >> 1;
+                return T{(u & 1u) ? ~v : v};
+            }
+        }
+
+        // 値の部分のバイト数
+        template <class T>
+        constexpr std::size_t payload_size(const unsigned_t<T>& u) noexcept
+        { return (u.get_bit_operator().get_bit_width() + 7) / 8; }
+    }
+
+    // 1要素の符号化後の最大バイト数
+    template <TuFmpIntegral T>
+    inline constexpr std::size_t varint_max_size_v = _varint_impl::length_size(sizeof(T)) + sizeof(T);
+
+    // 符号化後のバイト数
+    template <TuFmpIntegral T>
+    constexpr std::size_t varint_size(const T& v) noexcept
+    {
+        const auto n = _varint_impl::payload_size<T>(_varint_impl::zigzag(v));
+        return _varint_impl::length_size(n) + n;
+    }
+
+    // 符号化
+    // @return 書き込んだバイト数
+    // @throw std::out_of_range 書き込み先が足りない場合
+    template <TuFmpIntegral T>
+    constexpr std::size_t varint_encode(const T& v, std::span<std::byte> out)
+    {
+        const auto u = _varint_impl::zigzag(v);
+        const auto n = _varint_impl::payload_size<T>(u);
+        const auto size = _varint_impl::length_size(n) + n;
+        if (out.size() < size)
+            throw std::out_of_range{"Not enough bytes to encode fmpint."};
+
+        std::size_t pos = 0;
+        auto len = n;
+        for (; len >= 0x80; len >>= 7)
+            out[pos++] = static_cast<std::byte>((len & 0x7F) | 0x80);
+        out[pos++] = static_cast<std::byte>(len);
+        const auto bytes = _bytes_impl::to_le_bytes(u);
+        std::copy_n(bytes.begin(), n, out.begin() + pos);
+        return size;
+    }
+
+    // 復号
+    // @return 読み込んだバイト数
+    // @throw std::out_of_range 入力が途中で終わっている場合
+    // @throw std::invalid_argument 値のバイト数が型の大きさを超える場合
+    template <TuFmpIntegral T>
+    constexpr std::size_t varint_decode(std::span<const std::byte> in, T& out)
+    {
+        std::size_t n = 0, pos = 0;
+        for (std::size_t shift = 0;; shift += 7) {
+            if (pos >= in.size())
+                throw std::out_of_range{"Truncated varint."};
+            const auto b = static_cast<std::uint8_t>(in[pos++]);
+            n |= std::size_t{b & 0x7Fu} << shift;
+            if (!(b & 0x80))
+                break;
+            if (shift >= 7 * 3)
+                throw std::invalid_argument{"Invalid varint length."};
+        }
+        if (n > sizeof(T))
+            throw std::invalid_argument{"Invalid varint length."};
+        if (in.size() - pos < n)
+            throw std::out_of_range{"Truncated varint."};
+
+        auto bytes = _bytes_impl::bytes_t<T>{};
+        std::copy_n(in.begin() + pos, n, bytes.begin());
+        out = _varint_impl::unzigzag<T>(_bytes_impl::from_le_bytes<_varint_impl::unsigned_t<T>>(bytes));
+        return pos + n;
+    }
+
+    // -------------------------------------------
+    // 配列の一括符号化、復号
+    // 要素を先頭から隙間なく並べる
+    // -------------------------------------------
+
+    // @return 書き込んだバイト数
+    template <class T>
+    requires TuFmpIntegral<std::remove_const_t<T>>
+    constexpr std::size_t varint_encode(std::span<T> in, std::span<std::byte> out)
+    {
+        std::size_t pos = 0;
+        for (const auto& v : in)
+            pos += varint_encode(v, out.subspan(pos));
+        return pos;
+    }
+
+    // out の全要素を復号する
+    // @return 読み込んだバイト数
+    template <TuFmpIntegral T>
+    constexpr std::size_t varint_decode(std::span<const std::byte> in, std::span<T> out)
+    {
+        std::size_t pos = 0;
+        for (auto& v : out)
+            pos += varint_decode(in.subspan(pos), v);
+        return pos;
+    }
+}
+
+#endif
@@ -5,16 +5,21 @@
 #define TUNUM_COMMON_INCLUDE(path) <tunum/path>
 #endif
 
+#include <span>
 #include <stdexcept>
 
 #include TUNUM_COMMON_INCLUDE(math/floating.hpp)
 #include TUNUM_COMMON_INCLUDE(math/abs.hpp)
 #include TUNUM_COMMON_INCLUDE(math/exp.hpp)
+#include TUNUM_COMMON_INCLUDE(math/log.hpp)
 #include TUNUM_COMMON_INCLUDE(math/sqrt.hpp)
+#include TUNUM_COMMON_INCLUDE(math/cbrt.hpp)
 
 namespace tunum
 {
     // 自然対数の近似値算出
+    // 倍精度以下の型でnが0の場合は、多項式近似(誤差1ulp未満)で計算する
+    // それ以外は級数展開で計算する
     // 参考: https://qiita.com/MilkySaitou/items/614fcbb110cae5b9f797
     // @tparam FloatT 任意の組み込み浮動小数点型
     // @param x 求めたい自然対数の真数
@@ -24,6 +29,9 @@ namespace tunum
     {
         if (x <= 0)
             throw std::invalid_argument("'x' less than 0 cannot be specified.");
+        if constexpr (_math_impl::std_floating_log_kernel::is_supported<FloatT>)
+            if (n == 0)
+                return _math_impl::std_floating_log_kernel::ln(x);
 
         const FloatT base_numerator = x - 1;
         if (abs(base_numerator) >= 1)
@@ -61,6 +69,57 @@ namespace tunum
     }
     inline constexpr auto ln(std::integral auto x, std::size_t n = 0) { return ln(static_cast<double>(x), n); }
 
+    // 配列の各要素を自然対数の結果で置き換える
+    // 0以下の要素が含まれる場合は例外を送出する(送出時点までの要素は置き換え済みとなる)
+    // @param xs 求めたい自然対数の真数の配列
+    template <std::floating_point FloatT, std::size_t Extent>
+    inline constexpr void ln(std::span<FloatT, Extent> xs)
+    {
+        using kernel_t = _math_impl::std_floating_log_kernel;
+        if constexpr (kernel_t::is_supported<FloatT>)
+            kernel_t::run(
+                std::span<FloatT>{xs},
+                [](const kernel_t::reduced_t& v) { return kernel_t::ln_core(v); },
+                [](FloatT x) { return ln(x); }
+            );
+        else
+            for (auto& x : xs)
+                x = ln(x);
+    }
+
+    // 2を底とする対数
+    // 倍精度以下の型は多項式近似(誤差1ulp未満)で計算する
+    // @param x 求めたい対数の真数
+    template <std::floating_point FloatT>
+    inline constexpr FloatT log2(FloatT x)
+    {
+        if (x <= 0)
+            throw std::invalid_argument("'x' less than 0 cannot be specified.");
+        if constexpr (_math_impl::std_floating_log_kernel::is_supported<FloatT>)
+            return _math_impl::std_floating_log_kernel::log2(x);
+        else
+            return ln(x) / std::numbers::ln2_v<FloatT>;
+    }
+    inline constexpr auto log2(std::integral auto x) { return log2(static_cast<double>(x)); }
+
+    // 配列の各要素を2を底とする対数の結果で置き換える
+    // 0以下の要素が含まれる場合は例外を送出する(送出時点までの要素は置き換え済みとなる)
+    // @param xs 求めたい対数の真数の配列
+    template <std::floating_point FloatT, std::size_t Extent>
+    inline constexpr void log2(std::span<FloatT, Extent> xs)
+    {
+        using kernel_t = _math_impl::std_floating_log_kernel;
+        if constexpr (kernel_t::is_supported<FloatT>)
+            kernel_t::run(
+                std::span<FloatT>{xs},
+                [](const kernel_t::reduced_t& v) { return kernel_t::log2_core(v); },
+                [](FloatT x) { return log2(x); }
+            );
+        else
+            for (auto& x : xs)
+                x = log2(x);
+    }
+
     // 対数
     // @param base 対数の底
     // @param x 求めたい対数の真数
@@ -0,0 +1,101 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_MATH_CBRT_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_MATH_CBRT_HPP
+
+#include <cmath>
+#include <limits>
+#include TUNUM_COMMON_INCLUDE(math/sqrt.hpp)
+
+namespace tunum::_math_impl
+{
+    // 立方根算出の実装
+    // x = m * 2^(3q) (1 <= m < 8)と分解し、mの立方根を1次式の初期値から固定回数のニュートン法で求める
+    // 最後に残差を誤差なく算出して補正する(倍精度以下の型で誤差1ulp未満)
+    struct std_floating_cbrt_impl
+    {
+        // [1, 8)でのcbrtの1次近似(相対誤差0.058未満)
+        template <std::floating_point FloatT>
+        static constexpr FloatT initial_value(FloatT m) noexcept
+        { return FloatT(0x1.d01p-1) + FloatT(0x1.356p-3) * m; }
+
+        // mの立方根(1 <= m < 8)
+        template <std::floating_point FloatT>
+        static constexpr FloatT cbrt_newton(FloatT m, int iteration) noexcept
+        {
+            auto y = initial_value(m);
+            for (int i = 0; i < iteration; i++)
+                y = (2 * y + m / (y * y)) / 3;
+            return y;
+        }
+
+        // 正の有限値の立方根
+        template <std::floating_point FloatT>
+        static constexpr FloatT run_positive(FloatT x) noexcept
+        {
+            if constexpr (is_root_kernel_supported<FloatT>) {
+                using kernel_t = std_floating_root_kernel<FloatT>;
+                constexpr auto iteration = kernel_t::iteration_count(0x1p-4, 1.5);
+
+                const auto [m, q] = kernel_t::decompose(x, 3);
+                const auto y = cbrt_newton(m, iteration);
+
+                // 残差 m - y^3
+                const auto [yy_hi, yy_lo] = kernel_t::two_prod(y, y);
+                const auto [p_hi, p_lo] = kernel_t::two_prod(y, yy_hi);
+                const auto r = ((m - p_hi) - p_lo) - y * yy_lo;
+                return kernel_t::scale(y + r / (3 * y * y), q);
+            }
+            else {
+                // bit表現を解析できないため、8の累乗の乗除算で[1, 8)へ縮小する
+                auto scale = FloatT{1};
+                for (; x >= 8; scale *= 2)
+                    x /= 8;
+                for (; x < 1; scale /= 2)
+                    x *= 8;
+                auto y = initial_value(x);
+                for (int i = 0; i < 6; i++)
+                    y = (2 * y + x / (y * y)) / 3;
+                return y * scale;
+            }
+        }
+
+        template <std::floating_point FloatT>
+        static constexpr FloatT run(FloatT x) noexcept
+        {
+            if (x == 0 || x != x || x == std::numeric_limits<FloatT>::infinity() || x == -std::numeric_limits<FloatT>::infinity())
+                return x;
+            return x < 0
+                ? -run_positive(-x)
+                : run_positive(x);
+        }
+    };
+
+    // -----------------------------------------
+    // 立方根関数のオーバーロード列挙および、cpo定義
+    // -----------------------------------------
+
+    template <std::floating_point FloatT>
+    inline constexpr auto cbrt(FloatT x) noexcept
+    {
+        // 定数式と実行時で結果を一致させるため、倍精度以下の型は実行時も独自実装を使用
+        if constexpr (!is_root_kernel_supported<FloatT>)
+            if (!std::is_constant_evaluated())
+                return std::cbrt(x);
+        return std_floating_cbrt_impl::run(x);
+    }
+
+    struct cbrt_cpo
+    {
+        constexpr auto operator()(auto x) const
+        { return cbrt(x); }
+    };
+}
+
+namespace tunum
+{
+    // 立方根
+    // 倍精度以下の型では誤差1ulp未満
+    // @param x 引数
+    inline constexpr _math_impl::cbrt_cpo cbrt{};
+}
+
+#endif
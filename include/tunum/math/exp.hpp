@@ -6,7 +6,11 @@
 
 #include <bit>
 #include <cmath>
+#include <span>
 #include <array>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
 #include <numbers>
 #include <limits>
 
@@ -81,6 +85,163 @@ namespace tunum::_math_impl
         }
     };
 
+    // 倍精度以下の浮動小数点型の指数関数の実装(テーブル参照 + 多項式近似)
+    // x = (32m + j) * ln2 / 32 + r (|r| <= ln2 / 64) と分解し、exp(x) = 2^m * 2^(j/32) * exp(r) として計算する
+    // 2^(j/32)は上位、下位の2つの倍精度値で保持し、exp(r) - 1は6次の多項式で近似する(打ち切り誤差は2^-58未満)
+    // 誤差は倍精度で1ulp未満(結果が非正規化数となる場合を除く)
+    // 定数式と実行時で同じ演算を行うため、結果は一致する
+    struct std_floating_exp_kernel
+    {
+        using info_t = floating_std_info<double>;
+        using bits_t = typename info_t::data_store_t;
+
+        // 倍精度で計算し、結果を丸めることで精度を保証できる型
+        template <class FloatT>
+        static constexpr bool is_supported = std::numeric_limits<FloatT>::is_iec559
+            && std::numeric_limits<FloatT>::digits <= std::numeric_limits<double>::digits;
+
+        static constexpr int table_bits = 5;
+        static constexpr int table_size = 1 << table_bits;
+
+        // 2^(j/32)の上位、下位
+        static constexpr auto table = std::array{
+            std::array{0x1.0000000000000p+0, 0x0.0p+0},
+            std::array{0x1.059b0d3158574p+0, 0x1.d73e2a475b465p-55},
+            std::array{0x1.0b5586cf9890fp+0, 0x1.8a62e4adc610bp-54},
+            std::array{0x1.11301d0125b51p+0, -0x1.6c51039449b3ap-54},
+            std::array{0x1.172b83c7d517bp+0, -0x1.19041b9d78a76p-55},
+            std::array{0x1.1d4873168b9aap+0, 0x1.e016e00a2643cp-54},
+            std::array{0x1.2387a6e756238p+0, 0x1.9b07eb6c70573p-54},
+            std::array{0x1.29e9df51fdee1p+0, 0x1.612e8afad1255p-55},
+            std::array{0x1.306fe0a31b715p+0, 0x1.6f46ad23182e4p-55},
+            std::array{0x1.371a7373aa9cbp+0, -0x1.63aeabf42eae2p-54},
+            std::array{0x1.3dea64c123422p+0, 0x1.ada0911f09ebcp-55},
+            std::array{0x1.44e086061892dp+0, 0x1.89b7a04ef80d0p-59},
+            std::array{0x1.4bfdad5362a27p+0, 0x1.d4397afec42e2p-56},
+            std::array{0x1.5342b569d4f82p+0, -0x1.07abe1db13cadp-55},
+            std::array{0x1.5ab07dd485429p+0, 0x1.6324c054647adp-54},
+            std::array{0x1.6247eb03a5585p+0, -0x1.383c17e40b497p-54},
+            std::array{0x1.6a09e667f3bcdp+0, -0x1.bdd3413b26456p-54},
+            std::array{0x1.71f75e8ec5f74p+0, -0x1.16e4786887a99p-55},
+            std::array{0x1.7a11473eb0187p+0, -0x1.41577ee04992fp-55},
+            std::array{0x1.82589994cce13p+0, -0x1.d4c1dd41532d8p-54},
+            std::array{0x1.8ace5422aa0dbp+0, 0x1.6e9f156864b27p-54},
+            std::array{0x1.93737b0cdc5e5p+0, -0x1.75fc781b57ebcp-57},
+            std::array{0x1.9c49182a3f090p+0, 0x1.c7c46b071f2bep-56},
+            std::array{0x1.a5503b23e255dp+0, -0x1.d2f6edb8d41e1p-54},
+            std::array{0x1.ae89f995ad3adp+0, 0x1.7a1cd345dcc81p-54},
+            std::array{0x1.b7f76f2fb5e47p+0, -0x1.5584f7e54ac3bp-56},
+            std::array{0x1.c199bdd85529cp+0, 0x1.11065895048ddp-55},
+            std::array{0x1.cb720dcef9069p+0, 0x1.503cbd1e949dbp-56},
+            std::array{0x1.d5818dcfba487p+0, 0x1.2ed02d75b3707p-55},
+            std::array{0x1.dfc97337b9b5fp+0, -0x1.1a5cd4f184b5cp-54},
+            std::array{0x1.ea4afa2a490dap+0, -0x1.e9c23179c2893p-54},
+            std::array{0x1.f50765b6e4540p+0, 0x1.9d3e12dd8a18bp-54},
+        };
+
+        // 32 / ln2
+        static constexpr double inv_ln2_n = 0x1.71547652b82fep+5;
+        // ln2 / 32 の上位(下位21bitが0であり、整数倍が正確に計算可能)、下位
+        static constexpr double ln2_n_hi = 0x1.62e42fee00000p-6;
+        static constexpr double ln2_n_lo = 0x1.a39ef35793c76p-38;
+        // 加減算により最近接偶数への丸めを行うための定数(1.5 * 2^52)
+        static constexpr double round_shift = 0x1.8p52;
+
+        // 結果が正規化数となり、2^mを指数部への加算で表現できる範囲
+        static constexpr double fast_min = -708.;
+        static constexpr double fast_max = 709.;
+        // 単精度の場合は、結果が単精度の正規化数となる範囲
+        static constexpr double fast_min_f = -87.;
+        static constexpr double fast_max_f = 88.;
+        // 結果が無限大、ゼロとなる境界
+        static constexpr double overflow_threshold = 0x1.62e42fefa39efp+9;
+        static constexpr double underflow_threshold = -0x1.74910d52d3051p+9;
+
+        // exp(x) = y * 2^m の y, m を算出
+        static constexpr auto reduce(double x) noexcept
+        {
+            // 丸め後の値の下位bitがそのまま整数値kとなる
+            const auto shifted = x * inv_ln2_n + round_shift;
+            const auto k = static_cast<std::int64_t>(std::bit_cast<bits_t>(shifted) - std::bit_cast<bits_t>(round_shift));
+            const auto kd = shifted - round_shift;
+            const auto r = (x - kd * ln2_n_hi) - kd * ln2_n_lo;
+
+            // exp(r) - 1
+            const auto p = r + r * r * (1. / 2 + r * (1. / 6 + r * (1. / 24 + r * (1. / 120 + r * (1. / 720)))));
+            const auto& t = table[k & (table_size - 1)];
+            return std::pair{t[0] + (t[0] * p + t[1]), k >> table_bits};
+        }
+
+        // 高速経路(fast_min <= x <= fast_max)
+        // 分岐を含まないため、配列に対してベクトル化が可能
+        static constexpr double core(double x) noexcept
+        {
+            const auto [y, m] = reduce(x);
+            return std::bit_cast<double>(
+                std::bit_cast<bits_t>(y) + (static_cast<bits_t>(m) << info_t::mantissa_width)
+            );
+        }
+
+        // 倍精度での実装
+        static constexpr double run_double(double x) noexcept
+        {
+            if (fast_min <= x && x <= fast_max)
+                return core(x);
+            if (x != x)
+                return x;
+            if (x > overflow_threshold)
+                return info_t::get_infinity();
+            if (x < underflow_threshold)
+                return 0.;
+
+            // 2^mが正規化数で表現できないため、2回に分けて乗算する
+            const auto [y, m] = reduce(x);
+            return m > 0
+                ? y * info_t::exp2_integral(static_cast<int>(m) - 1) * 2.
+                : y * info_t::exp2_integral(static_cast<int>(m) + 64) * info_t::exp2_integral(-64);
+        }
+
+        template <std::floating_point FloatT>
+        static constexpr FloatT run(FloatT x) noexcept
+        {
+            const auto result = run_double(static_cast<double>(x));
+            if constexpr (std::is_same_v<FloatT, double>)
+                return result;
+            else {
+                // 丸めにより無限大となる値は、変換前に判定
+                using limits_t = std::numeric_limits<FloatT>;
+                constexpr auto max_ulp = floating_std_info<FloatT>::exp2_integral(limits_t::max_exponent - limits_t::digits);
+                constexpr auto overflow_bound = static_cast<double>(limits_t::max()) + static_cast<double>(max_ulp) / 2;
+                return result >= overflow_bound
+                    ? limits_t::infinity()
+                    : static_cast<FloatT>(result);
+            }
+        }
+
+        // 配列の各要素について計算
+        // 高速経路の範囲外の要素を含まないブロックは、分岐のないループ(ベクトル化可能)で処理する
+        template <std::floating_point FloatT>
+        static constexpr void run(std::span<FloatT> xs) noexcept
+        {
+            constexpr auto is_double = std::is_same_v<FloatT, double>;
+            constexpr auto min = is_double ? fast_min : fast_min_f;
+            constexpr auto max = is_double ? fast_max : fast_max_f;
+            constexpr std::size_t block_size = 64;
+            for (std::size_t i = 0; i < xs.size(); i += block_size) {
+                const auto block = xs.subspan(i, (std::min)(block_size, xs.size() - i));
+                auto is_fast = true;
+                for (const auto x : block)
+                    is_fast &= (min <= x) & (x <= max);
+                if (is_fast)
+                    for (auto& x : block)
+                        x = static_cast<FloatT>(core(static_cast<double>(x)));
+                else
+                    for (auto& x : block)
+                        x = run(x);
+            }
+        }
+    };
+
     // -----------------------------------------
     // 指数関数のオーバーロード列挙および、cpo定義
     // -----------------------------------------
@@ -88,9 +249,25 @@ namespace tunum::_math_impl
     template <std::floating_point FloatT>
     inline constexpr auto exp(FloatT x) noexcept
     {
-        if (!std::is_constant_evaluated())
-            return std::exp(x);
-        return std_floating_exp_impl::run(x);
+        // 定数式と実行時で結果を一致させるため、実行時も独自実装を使用
+        if constexpr (std_floating_exp_kernel::is_supported<FloatT>)
+            return std_floating_exp_kernel::run(x);
+        else {
+            if (!std::is_constant_evaluated())
+                return std::exp(x);
+            return std_floating_exp_impl::run(x);
+        }
+    }
+
+    // 配列の各要素を指数関数の結果で置き換える
+    template <std::floating_point FloatT, std::size_t Extent>
+    inline constexpr void exp(std::span<FloatT, Extent> xs) noexcept
+    {
+        if constexpr (std_floating_exp_kernel::is_supported<FloatT>)
+            std_floating_exp_kernel::run(std::span<FloatT>{xs});
+        else
+            for (auto& x : xs)
+                x = exp(x);
     }
 
     struct exp_cpo
@@ -103,6 +280,7 @@ namespace tunum::_math_impl
 namespace tunum
 {
     // 指数関数の近似値算出。
+    // 配列(std::span)を渡した場合は、各要素を結果で置き換える
     // @param x 求めたい指数
     inline constexpr _math_impl::exp_cpo exp{};
 }
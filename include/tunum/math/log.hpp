@@ -0,0 +1,150 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_MATH_LOG_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_MATH_LOG_HPP
+
+#include TUNUM_COMMON_INCLUDE(floating.hpp)
+
+#include <bit>
+#include <span>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include <limits>
+
+namespace tunum::_math_impl
+{
+    // 倍精度以下の浮動小数点型の対数関数の実装
+    // x = 2^k * (1 + f) (sqrt(2)/2 <= 1 + f < sqrt(2))と分解し、
+    // ln(1 + f) = 2s + s^3 * R(s^2) (s = f / (2 + f))のRを7次の多項式で近似する(fdlibmと同じ手法)
+    // 誤差は倍精度で1ulp未満であり、定数式と実行時で同じ演算を行うため、結果は一致する
+    // 正の有限値のみを受け付ける(範囲外の判定は呼び出し側で行う)
+    struct std_floating_log_kernel
+    {
+        using info_t = floating_std_info<double>;
+        using bits_t = typename info_t::data_store_t;
+
+        // 倍精度で計算し、結果を丸めることで精度を保証できる型
+        template <class FloatT>
+        static constexpr bool is_supported = std::numeric_limits<FloatT>::is_iec559
+            && std::numeric_limits<FloatT>::digits <= std::numeric_limits<double>::digits;
+
+        // ln2 の上位(下位32bitが0であり、整数倍が正確に計算可能)、下位
+        static constexpr double ln2_hi = 0x1.62e42fee00000p-1;
+        static constexpr double ln2_lo = 0x1.a39ef35793c76p-33;
+        // 1 / ln2 の上位、下位
+        static constexpr double inv_ln2_hi = 0x1.7154765200000p+0;
+        static constexpr double inv_ln2_lo = 0x1.705fc2eefa200p-33;
+        // Rの近似多項式の係数
+        static constexpr double lg1 = 0x1.5555555555593p-1;
+        static constexpr double lg2 = 0x1.999999997fa04p-2;
+        static constexpr double lg3 = 0x1.2492494229359p-2;
+        static constexpr double lg4 = 0x1.c71c51d8e78afp-3;
+        static constexpr double lg5 = 0x1.7466496cb03dep-3;
+        static constexpr double lg6 = 0x1.39a09d078c69fp-3;
+        static constexpr double lg7 = 0x1.2f112df3e5244p-3;
+        // sqrt(2)/2 のbit表現(仮数部の範囲を[sqrt(2)/2, sqrt(2))へずらすために使用)
+        static constexpr bits_t reduce_offset = 0x3fe6a09e667f3bcd;
+
+        // 分解後の値
+        struct reduced_t
+        {
+            // 2の指数
+            double k;
+            // 1 + f の f
+            double f;
+            // f^2 / 2
+            double hfsq;
+            // s * (f^2 / 2 + R)
+            double r;
+        };
+
+        // x = 2^k * (1 + f) の分解と、多項式の評価
+        // 分岐を含まないため、正規化数の配列に対してベクトル化が可能
+        static constexpr reduced_t reduce_normal(double x) noexcept
+        {
+            const auto bits = std::bit_cast<bits_t>(x);
+            const auto tmp = bits - reduce_offset;
+            const auto k = static_cast<std::int64_t>(tmp) >> info_t::mantissa_width;
+            const auto m = bits - (static_cast<bits_t>(k) << info_t::mantissa_width);
+            const auto f = std::bit_cast<double>(m) - 1.;
+
+            const auto s = f / (2. + f);
+            const auto z = s * s;
+            const auto w = z * z;
+            const auto R = z * (lg1 + w * (lg3 + w * (lg5 + w * lg7))) + w * (lg2 + w * (lg4 + w * lg6));
+            const auto hfsq = .5 * f * f;
+            return {static_cast<double>(k), f, hfsq, s * (hfsq + R)};
+        }
+
+        // 非正規化数の場合、2^54倍して正規化数として分解する
+        static constexpr reduced_t reduce(double x) noexcept
+        {
+            if (x >= info_t::get_min())
+                return reduce_normal(x);
+            auto result = reduce_normal(x * info_t::exp2_integral(54));
+            result.k -= 54;
+            return result;
+        }
+
+        // 高速経路の範囲(正規化数の正の有限値)
+        static constexpr bool is_fast(double x) noexcept
+        { return (info_t::get_min() <= x) & (x <= info_t::get_max()); }
+
+        // 自然対数(正規化数のみ)
+        static constexpr double ln_core(const reduced_t& v) noexcept
+        { return v.k * ln2_hi - ((v.hfsq - (v.r + v.k * ln2_lo)) - v.f); }
+
+        // 2を底とする対数(正規化数のみ)
+        // ln(1 + f)を上位、下位に分けて1/ln2を乗算し、整数部kとの加算誤差も補正する
+        static constexpr double log2_core(const reduced_t& v) noexcept
+        {
+            const auto hi = std::bit_cast<double>(
+                std::bit_cast<bits_t>(v.f - v.hfsq) & ~bits_t{0xffffffff}
+            );
+            const auto lo = (v.f - hi) - v.hfsq + v.r;
+            const auto val_hi = hi * inv_ln2_hi;
+            const auto w = v.k + val_hi;
+            return (lo + hi) * inv_ln2_lo + lo * inv_ln2_hi + ((v.k - w) + val_hi) + w;
+        }
+
+        // 範囲外の値(0以下を除く)の処理を含めた実行
+        template <std::floating_point FloatT, class CoreF>
+        static constexpr FloatT run(FloatT x, CoreF core) noexcept
+        {
+            // 非数および、無限大はそのまま返す
+            if (x != x || x == std::numeric_limits<FloatT>::infinity())
+                return x;
+            return static_cast<FloatT>(core(reduce(static_cast<double>(x))));
+        }
+
+        template <std::floating_point FloatT>
+        static constexpr FloatT ln(FloatT x) noexcept
+        { return run(x, [](const reduced_t& v) { return ln_core(v); }); }
+
+        template <std::floating_point FloatT>
+        static constexpr FloatT log2(FloatT x) noexcept
+        { return run(x, [](const reduced_t& v) { return log2_core(v); }); }
+
+        // 配列の各要素について計算
+        // 正規化数の正の有限値のみを含むブロックは、分岐のないループ(ベクトル化可能)で処理する
+        // @param scalar 範囲外の要素を含むブロックの各要素に適用する関数(0以下の値の判定を含む)
+        template <std::floating_point FloatT, class CoreF, class ScalarF>
+        static constexpr void run(std::span<FloatT> xs, CoreF core, ScalarF scalar)
+        {
+            constexpr std::size_t block_size = 64;
+            for (std::size_t i = 0; i < xs.size(); i += block_size) {
+                const auto block = xs.subspan(i, (std::min)(block_size, xs.size() - i));
+                auto is_fast_block = true;
+                for (const auto x : block)
+                    is_fast_block &= is_fast(static_cast<double>(x));
+                if (is_fast_block)
+                    for (auto& x : block)
+                        x = static_cast<FloatT>(core(reduce_normal(static_cast<double>(x))));
+                else
+                    for (auto& x : block)
+                        x = scalar(x);
+            }
+        }
+    };
+}
+
+#endif
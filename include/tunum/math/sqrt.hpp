@@ -2,39 +2,206 @@
 #define TUNUM_INCLUDE_GUARD_TUNUM_MATH_SQRT_HPP
 
 #include <cmath>
+#include <limits>
+#include <utility>
+#include <stdexcept>
+#include TUNUM_COMMON_INCLUDE(floating.hpp)
 #include TUNUM_COMMON_INCLUDE(numerical_calc.hpp)
 
 namespace tunum::_math_impl
 {
-    // 1より小さい場合は逆数を計算
-    // 2または3の累乗から最も近い値を選択し、初期値を2または3の平方根の定数から算出する
+    // 累乗根の独自実装(root_kernel)を使用可能な型
+    // bit表現を解析できる倍精度以下の型に限定する
+    template <class FloatT>
+    inline constexpr bool is_root_kernel_supported = std::numeric_limits<FloatT>::is_iec559
+        && std::numeric_limits<FloatT>::digits <= std::numeric_limits<double>::digits;
+
+    // 累乗根の計算で共有する処理
+    // x = m * 2^(n * q) (1 <= m < 2^n)と分解して指数部をn等分し、
+    // mの累乗根のみを、1次式の初期値から固定回数のニュートン法で求める
+    template <std::floating_point FloatT>
+    struct std_floating_root_kernel
+    {
+        using info_t = floating_std_info<FloatT>;
+        using limits_t = std::numeric_limits<FloatT>;
+
+        // 非正規化数を正規化数とするために乗算する2の指数(2および3の倍数)
+        static constexpr int normalize_exponent = (limits_t::digits + 5) / 6 * 6;
+
+        // 誤差なく上位、下位に分割するための定数(2^ceil(digits / 2) + 1)
+        static constexpr FloatT split_factor = info_t::exp2_integral((limits_t::digits + 1) / 2) + 1;
+
+        // ニュートン法の反復回数を算出
+        // 相対誤差errorが1回の反復でfactor * error^2以下となるとき、型の精度の半ulp未満となるまでの回数
+        // @param error 初期値の最大相対誤差
+        // @param factor 収束の係数
+        static constexpr int iteration_count(double error, double factor) noexcept
+        {
+            const auto threshold = floating_std_info<double>::exp2_integral(-(limits_t::digits + 1));
+            auto count = 0;
+            for (; error > threshold; count++)
+                error = factor * error * error;
+            return count;
+        }
+
+        // x = m * 2^(n * q) (1 <= m < 2^n)と分解
+        // @param x 正の有限値
+        // @param n 指数の分割数
+        // @return {m, q}
+        static constexpr std::pair<FloatT, int> decompose(FloatT x, int n) noexcept
+        {
+            auto shift = 0;
+            if (x < limits_t::min()) {
+                x *= info_t::exp2_integral(normalize_exponent);
+                shift = normalize_exponent;
+            }
+            const auto info = info_t{x};
+            const auto exp = static_cast<int>(info.exponent()) - shift;
+            const auto q = (exp >= 0 ? exp : exp - (n - 1)) / n;
+            return {static_cast<FloatT>(info.change_exponent(exp - q * n)), q};
+        }
+
+        // y * 2^q
+        static constexpr FloatT scale(FloatT y, int q) noexcept
+        { return static_cast<FloatT>(info_t{y}.add_exponent(q)); }
+
+        // 隣接する値(正の正規化数のみ)
+        static constexpr FloatT next_up(FloatT y) noexcept
+        { return static_cast<FloatT>(info_t{info_t{y}.data + 1}); }
+        static constexpr FloatT next_down(FloatT y) noexcept
+        { return static_cast<FloatT>(info_t{info_t{y}.data - 1}); }
+
+        // a * b を誤差なく、上位と下位の和で表す(Dekkerの手法)
+        static constexpr std::pair<FloatT, FloatT> two_prod(FloatT a, FloatT b) noexcept
+        {
+            const auto split = [](FloatT v) {
+                const auto t = split_factor * v;
+                const auto hi = t - (t - v);
+                return std::pair{hi, v - hi};
+            };
+            const auto p = a * b;
+            const auto [a_hi, a_lo] = split(a);
+            const auto [b_hi, b_lo] = split(b);
+            return {p, ((a_hi * b_hi - p) + a_hi * b_lo + a_lo * b_hi) + a_lo * b_lo};
+        }
+
+        // x - a * b の符号を誤差なく判定(a * b が x の半分から2倍の範囲にあること)
+        static constexpr int compare_prod(FloatT x, FloatT a, FloatT b) noexcept
+        {
+            const auto [hi, lo] = two_prod(a, b);
+            const auto d = x - hi;
+            return d > lo ? 1 : (d < lo ? -1 : 0);
+        }
+
+        // ------------------------------------
+        // 平方根
+        // ------------------------------------
+
+        static constexpr int sqrt_iteration = iteration_count(0x1p-5, 1.);
+
+        // 正しく丸められた平方根(正の有限値のみ)
+        static constexpr FloatT sqrt(FloatT x) noexcept
+        {
+            const auto [m, q] = decompose(x, 2);
+            // [1, 4)でのsqrtの1次近似(相対誤差0.03未満)
+            auto y = FloatT(0x1.5f64p-1) + FloatT(0x1.5f64p-2) * m;
+            for (int i = 0; i < sqrt_iteration; i++)
+                y = (y + m / y) / 2;
+
+            // y * (yの前後の値) と比較し、最近接の値へ補正(Tuckermanの判定)
+            while (true) {
+                if (compare_prod(m, y, next_down(y)) <= 0)
+                    y = next_down(y);
+                else if (compare_prod(m, y, next_up(y)) > 0)
+                    y = next_up(y);
+                else
+                    break;
+            }
+            return scale(y, q);
+        }
+
+        // ------------------------------------
+        // 平方根の逆数
+        // ------------------------------------
+
+        static constexpr int rsqrt_iteration = iteration_count(0x1.7p-4, 2.);
+
+        // 平方根の逆数(正の有限値のみ)
+        // 除算を用いないニュートン法で求め、最後に残差を誤差なく算出して補正する(誤差1ulp未満)
+        static constexpr FloatT rsqrt(FloatT x) noexcept
+        {
+            const auto [m, q] = decompose(x, 2);
+            // [1, 4)でのrsqrtの1次近似(相対誤差0.087未満)
+            auto y = FloatT(0x1.1103p+0) - FloatT(0x1.37fp-3) * m;
+            for (int i = 0; i < rsqrt_iteration; i++)
+                y += y * (1 - m * y * y) / 2;
+
+            // 残差 1 - m * y^2
+            const auto [yy_hi, yy_lo] = two_prod(y, y);
+            const auto [p_hi, p_lo] = two_prod(m, yy_hi);
+            const auto r = ((1 - p_hi) - p_lo) - m * yy_lo;
+            return scale(y + y * r / 2, -q);
+        }
+    };
+
     // 平方根算出の実装
+    // 倍精度以下の型は指数部を半分にした初期値から固定回数のニュートン法で求め、正しく丸める
+    // それ以外の型は、1より小さい場合は逆数を計算し、1を初期値としてニュートン法で求める
     struct std_floating_sqrt_impl
     {
+        // 1から開始すると、1回の反復でおおよそ半分ずつしか近づかないため、反復回数の上限は指数の最大値程度とする
         template <std::floating_point FloatT>
         static constexpr FloatT sqrt_newton(FloatT x) noexcept
         {
-           return newton_raphson{
-                    [x](FloatT v) { return v * v - x; },
-                    [](FloatT v) { return 2 * v; }
-                }
-                .resolve(FloatT{1});
+           using limits_t = std::numeric_limits<FloatT>;
+           return newton_raphson{[x](const auto& v) { return v * v - x; }}
+                .solve(FloatT{1}, step_tolerance<FloatT>{}, limits_t::max_exponent + limits_t::digits)
+                .value;
         }
 
-        static constexpr auto run(std::floating_point auto x)
+        template <std::floating_point FloatT>
+        static constexpr FloatT run(FloatT x)
         {
             if (x < 0)
                 throw std::invalid_argument("Argment 'x' cannot have a value less than zero.");
-            if (x == 0 || x == 1)
+            if (x == 0 || x != x || x == std::numeric_limits<FloatT>::infinity())
                 return x;
-            if (x < 1)
-                return 1 / run(1 / x);
-            return sqrt_newton(x);
+            if constexpr (is_root_kernel_supported<FloatT>)
+                return std_floating_root_kernel<FloatT>::sqrt(x);
+            else {
+                if (x == 1)
+                    return x;
+                if (x < 1)
+                    return 1 / run(1 / x);
+                return sqrt_newton(x);
+            }
+        }
+    };
+
+    // 平方根の逆数算出の実装
+    struct std_floating_rsqrt_impl
+    {
+        template <std::floating_point FloatT>
+        static constexpr FloatT run(FloatT x)
+        {
+            using limits_t = std::numeric_limits<FloatT>;
+            if (x < 0)
+                throw std::invalid_argument("Argment 'x' cannot have a value less than zero.");
+            if (x != x)
+                return x;
+            if (x == 0)
+                return limits_t::infinity();
+            if (x == limits_t::infinity())
+                return FloatT{};
+            if constexpr (is_root_kernel_supported<FloatT>)
+                return std_floating_root_kernel<FloatT>::rsqrt(x);
+            else
+                return 1 / std_floating_sqrt_impl::run(x);
         }
     };
 
     // -----------------------------------------
-    // 指数関数のオーバーロード列挙および、cpo定義
+    // 平方根関数のオーバーロード列挙および、cpo定義
     // -----------------------------------------
 
     template <std::floating_point FloatT>
@@ -45,18 +212,35 @@ namespace tunum::_math_impl
         return std_floating_sqrt_impl::run(x);
     }
 
+    // 定数式と実行時で結果を一致させるため、実行時も独自実装を使用
+    template <std::floating_point FloatT>
+    inline constexpr auto rsqrt(FloatT x)
+    { return std_floating_rsqrt_impl::run(x); }
+
     struct sqrt_cpo
     {
         constexpr auto operator()(auto x) const
         { return sqrt(x); }
     };
+
+    struct rsqrt_cpo
+    {
+        constexpr auto operator()(auto x) const
+        { return rsqrt(x); }
+    };
 }
 
 namespace tunum
 {
-    // 絶対値
+    // 平方根
+    // 倍精度以下の型では、定数式でも正しく丸められた値を返す
     // @param x 引数
     inline constexpr _math_impl::sqrt_cpo sqrt{};
+
+    // 平方根の逆数
+    // 倍精度以下の型では誤差1ulp未満
+    // @param x 引数(0の場合は無限大)
+    inline constexpr _math_impl::rsqrt_cpo rsqrt{};
 }
 
 #endif
@@ -5,6 +5,12 @@
 #define TUNUM_COMMON_INCLUDE(path) <tunum/path>
 #endif
 
+#include TUNUM_COMMON_INCLUDE(numerical_calc/solver_result.hpp)
+#include TUNUM_COMMON_INCLUDE(numerical_calc/dual.hpp)
 #include TUNUM_COMMON_INCLUDE(numerical_calc/newton_raphson.hpp)
+#include TUNUM_COMMON_INCLUDE(numerical_calc/newton_raphson_batch.hpp)
+#include TUNUM_COMMON_INCLUDE(numerical_calc/halley.hpp)
+#include TUNUM_COMMON_INCLUDE(numerical_calc/secant.hpp)
+#include TUNUM_COMMON_INCLUDE(numerical_calc/brent.hpp)
 
 #endif
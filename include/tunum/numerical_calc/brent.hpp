@@ -0,0 +1,122 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_NUMERICAL_CALC_BRENT_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_NUMERICAL_CALC_BRENT_HPP
+
+#include <stdexcept>
+#include <algorithm>
+#include TUNUM_COMMON_INCLUDE(concepts.hpp)
+#include TUNUM_COMMON_INCLUDE(numerical_calc/solver_result.hpp)
+
+namespace tunum
+{
+    // ------------------------------------
+    // ブレント法
+    // 解を挟む区間を保持したまま、逆2次補間・割線法・二分法を切り替える(Brent-Dekker法)
+    // 補間が区間を十分に縮めない場合は二分法に切り替えるため、必ず区間内で収束する
+    // ------------------------------------
+
+    template <class F>
+    struct brent
+    {
+        // 近似対象の関数
+        F func;
+
+        constexpr brent(F&& f) noexcept
+            : func(f)
+        {}
+
+        constexpr brent(const F& f) noexcept
+            : func(f)
+        {}
+
+        // 区間[lower, upper]内の解の近似値を算出する
+        // 収束判定には、(区間幅の半分, 関数値)を渡す
+        // 区間の両端が隣接した場合も収束とする
+        // @param lower 区間の一端
+        // @param upper 区間の他端(lowerと関数値の符号が異なること)
+        // @param policy 収束判定の方針
+        // @param max_iteration 反復回数の上限
+        template <TuArithmetic T, TuConvergencePolicy<T> PolicyT = step_tolerance<T>>
+        requires TuArithmeticInvocable<F, T, T>
+        constexpr solver_result<T> solve(
+            const T& lower,
+            const T& upper,
+            const PolicyT& policy = {},
+            std::size_t max_iteration = default_max_iteration
+        ) const
+        {
+            const auto abs = [](const T& v) { return (std::max)(v, T{-v}); };
+
+            T a = lower, b = upper;
+            T fa = func(a), fb = func(b);
+            if (fa == 0)
+                return {a, 0, true};
+            if (fb == 0)
+                return {b, 0, true};
+            if ((fa > 0) == (fb > 0))
+                throw std::invalid_argument("The function values at 'lower' and 'upper' must have opposite signs.");
+
+            // bが最良の近似値、cはbとの間に解を挟む点
+            // dは直前の変化量、eはその1つ前の変化量
+            T c = a, fc = fa;
+            T d = b - a, e = d;
+            for (std::size_t i = 1; i <= max_iteration; i++) {
+                if ((fb > 0) == (fc > 0)) {
+                    c = a;
+                    fc = fa;
+                    d = e = b - a;
+                }
+                if (abs(fc) < abs(fb)) {
+                    a = b;
+                    b = c;
+                    c = a;
+                    fa = fb;
+                    fb = fc;
+                    fc = fa;
+                }
+
+                const T m = (c - b) / 2;
+                if (fb == 0 || policy(m, fb) || _numerical_calc_impl::is_adjacent(b, c))
+                    return {b, i - 1, true};
+
+                if (abs(e) > 0 && abs(fa) > abs(fb)) {
+                    // 補間を試みる(a == c の場合は割線法、それ以外は逆2次補間)
+                    const T s = fb / fa;
+                    T p = {}, q = {};
+                    if (a == c) {
+                        p = T{2} * m * s;
+                        q = T{1} - s;
+                    }
+                    else {
+                        const T qa = fa / fc;
+                        const T r = fb / fc;
+                        p = s * (T{2} * m * qa * (qa - r) - (b - a) * (r - T{1}));
+                        q = (qa - T{1}) * (r - T{1}) * (s - T{1});
+                    }
+                    if (p > 0)
+                        q = -q;
+                    else
+                        p = -p;
+
+                    // 補間値が区間内で、かつ前々回の変化量の半分未満であれば採用
+                    if (q != 0 && T{2} * p < (std::min)(T{T{3} * m * q}, abs(T{e * q}))) {
+                        e = d;
+                        d = p / q;
+                    }
+                    else
+                        d = e = m;
+                }
+                else
+                    d = e = m;
+
+                a = b;
+                fa = fb;
+                // 変化量が小さすぎて値が変わらない場合は二分法
+                b = (b + d == b) ? T{b + m} : T{b + d};
+                fb = func(b);
+            }
+            return {b, max_iteration, false};
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,111 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_NUMERICAL_CALC_DUAL_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_NUMERICAL_CALC_DUAL_HPP
+
+#include <compare>
+#include TUNUM_COMMON_INCLUDE(concepts.hpp)
+
+namespace tunum
+{
+    // ------------------------------------
+    // 二重数(前進型の自動微分)
+    // 値と微分係数を組で保持し、四則演算の際に微分係数も同時に算出する
+    // 比較は値のみで行う
+    // ------------------------------------
+
+    template <TuArithmetic T>
+    struct dual
+    {
+        // 値
+        T value = {};
+        // 微分係数
+        T derivative = {};
+
+        constexpr dual() = default;
+
+        // 定数(微分係数は0)、または値と微分係数を指定して生成
+        constexpr dual(const T& v, const T& d = T{}) noexcept
+            : value(v)
+            , derivative(d)
+        {}
+
+        // 整数等、Tへ変換可能な値から定数として生成
+        template <class U>
+        requires (!std::same_as<U, T> && std::convertible_to<U, T>)
+        constexpr dual(const U& v) noexcept
+            : value(v)
+            , derivative{}
+        {}
+
+        // 微分対象の変数として生成(微分係数は1)
+        static constexpr dual variable(const T& v) noexcept
+        { return dual{v, T{1}}; }
+
+        // 単項+
+        constexpr dual operator+() const noexcept
+        { return *this; }
+
+        // 単項-
+        constexpr dual operator-() const noexcept
+        { return dual{T{-value}, T{-derivative}}; }
+
+        // 加算代入
+        constexpr dual& operator+=(const dual& v) noexcept
+        {
+            value += v.value;
+            derivative += v.derivative;
+            return *this;
+        }
+
+        // 減算代入
+        constexpr dual& operator-=(const dual& v) noexcept
+        {
+            value -= v.value;
+            derivative -= v.derivative;
+            return *this;
+        }
+
+        // 乗算代入
+        // (uv)' = u'v + uv'
+        constexpr dual& operator*=(const dual& v) noexcept
+        {
+            derivative = derivative * v.value + value * v.derivative;
+            value *= v.value;
+            return *this;
+        }
+
+        // 除算代入
+        // (u/v)' = (u'v - uv') / v^2
+        constexpr dual& operator/=(const dual& v)
+        {
+            derivative = (derivative * v.value - value * v.derivative) / (v.value * v.value);
+            value /= v.value;
+            return *this;
+        }
+
+        friend constexpr dual operator+(dual l, const dual& r) noexcept
+        { return l += r; }
+
+        friend constexpr dual operator-(dual l, const dual& r) noexcept
+        { return l -= r; }
+
+        friend constexpr dual operator*(dual l, const dual& r) noexcept
+        { return l *= r; }
+
+        friend constexpr dual operator/(dual l, const dual& r)
+        { return l /= r; }
+
+        friend constexpr bool operator==(const dual& l, const dual& r) noexcept
+        { return l.value == r.value; }
+
+        friend constexpr auto operator<=>(const dual& l, const dual& r) noexcept
+        { return l.value <=> r.value; }
+    };
+
+    template <class T>
+    dual(T) -> dual<T>;
+
+    template <class T>
+    dual(T, T) -> dual<T>;
+}
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_NUMERICAL_CALC_HALLEY_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_NUMERICAL_CALC_HALLEY_HPP
+
+#include TUNUM_COMMON_INCLUDE(concepts.hpp)
+#include TUNUM_COMMON_INCLUDE(numerical_calc/solver_result.hpp)
+
+namespace tunum
+{
+    // ------------------------------------
+    // ハレー法(2次のHouseholder法)
+    // x - 2f(x)f'(x) / (2f'(x)^2 - f(x)f''(x)) で更新し、3次収束する
+    // ------------------------------------
+
+    template <class F, class DF, class DDF>
+    struct halley
+    {
+        // 近似対象の関数
+        F func;
+        // func を微分した関数
+        DF d_func;
+        // func を2階微分した関数
+        DDF dd_func;
+
+        constexpr halley(F&& f, DF&& df, DDF&& ddf) noexcept
+            : func(f)
+            , d_func(df)
+            , dd_func(ddf)
+        {}
+
+        constexpr halley(const F& f, const DF& df, const DDF& ddf) noexcept
+            : func(f)
+            , d_func(df)
+            , dd_func(ddf)
+        {}
+
+        // 関数の近似値を算出する
+        // 更新式の分母がゼロとなった場合は、その時点で打ち切る
+        // @param init 初期値
+        // @param policy 収束判定の方針
+        // @param max_iteration 反復回数の上限
+        template <TuArithmetic T, TuConvergencePolicy<T> PolicyT = step_tolerance<T>>
+        requires (TuArithmeticInvocable<F, T, T> && TuArithmeticInvocable<DF, T, T> && TuArithmeticInvocable<DDF, T, T>)
+        constexpr solver_result<T> solve(
+            const T& init,
+            const PolicyT& policy = {},
+            std::size_t max_iteration = default_max_iteration
+        ) const
+        {
+            return _numerical_calc_impl::iterate(
+                init,
+                [this](const T& x) {
+                    const T fx = func(x);
+                    if (fx == 0)
+                        return _numerical_calc_impl::iteration_step<T>{x, fx, true};
+                    const T dfx = d_func(x);
+                    const T denominator = T{2} * dfx * dfx - fx * dd_func(x);
+                    if (denominator == 0)
+                        return _numerical_calc_impl::iteration_step<T>{x, fx, false};
+                    return _numerical_calc_impl::iteration_step<T>{x - T{2} * fx * dfx / denominator, fx, true};
+                },
+                policy,
+                max_iteration
+            );
+        }
+    };
+}
+
+#endif
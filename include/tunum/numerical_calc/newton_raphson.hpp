@@ -3,14 +3,29 @@
 
 #include <stdexcept>
 #include TUNUM_COMMON_INCLUDE(concepts.hpp)
+#include TUNUM_COMMON_INCLUDE(numerical_calc/solver_result.hpp)
+#include TUNUM_COMMON_INCLUDE(numerical_calc/dual.hpp)
+
+namespace tunum::_numerical_calc_impl
+{
+    // 導関数を指定しない場合、funcへdualを渡して自動微分する
+    struct auto_derivative {};
+
+    // 導関数の指定、あるいは自動微分によって、funcとその微分係数を同時に算出可能か
+    template <class F, class DF, class T>
+    concept NewtonRaphsonInvocable
+        = (std::same_as<DF, auto_derivative> && TuArithmeticInvocable<F, dual<T>, dual<T>>)
+        || (TuArithmeticInvocable<F, T, T> && TuArithmeticInvocable<DF, T, T>);
+}
 
 namespace tunum
 {
     // ------------------------------------
     // ニュートン法
+    // 導関数を省略した場合は、funcへdualを渡す1回の評価で関数値と微分係数を得る
     // ------------------------------------
 
-    template <class F, class DF>
+    template <class F, class DF = _numerical_calc_impl::auto_derivative>
     struct newton_raphson
     {
         // 近似対象の関数
@@ -18,6 +33,16 @@ namespace tunum
         // func を微分した関数
         DF d_func;
 
+        constexpr newton_raphson(F&& f) noexcept
+            : func(f)
+            , d_func{}
+        {}
+
+        constexpr newton_raphson(const F& f) noexcept
+            : func(f)
+            , d_func{}
+        {}
+
         constexpr newton_raphson(F&& f, DF&& df) noexcept
             : func(f)
             , d_func(df)
@@ -29,28 +54,58 @@ namespace tunum
         {}
 
         // 関数の近似値を算出する
+        // 導関数がゼロとなった場合は、その時点で打ち切る
+        // @param init 初期値
+        // @param policy 収束判定の方針
+        // @param max_iteration 反復回数の上限
+        template <TuArithmetic T, TuConvergencePolicy<T> PolicyT = step_tolerance<T>>
+        requires _numerical_calc_impl::NewtonRaphsonInvocable<F, DF, T>
+        constexpr solver_result<T> solve(
+            const T& init,
+            const PolicyT& policy = {},
+            std::size_t max_iteration = default_max_iteration
+        ) const
+        {
+            return _numerical_calc_impl::iterate(
+                init,
+                [this](const T& x) {
+                    const auto [fx, dfx] = evaluate(x);
+                    if (fx == 0)
+                        return _numerical_calc_impl::iteration_step<T>{x, fx, true};
+                    if (dfx == 0)
+                        return _numerical_calc_impl::iteration_step<T>{x, fx, false};
+                    return _numerical_calc_impl::iteration_step<T>{x - fx / dfx, fx, true};
+                },
+                policy,
+                max_iteration
+            );
+        }
+
+        // 関数の近似値を算出する
+        // 反復回数の上限に達した場合は、その時点の値を返す
         // @param init 初期値
         // @param sigma 収束したとする誤差
         template <TuArithmetic T>
-        requires (TuArithmeticInvocable<F, T, T> && TuArithmeticInvocable<DF, T, T>)
+        requires _numerical_calc_impl::NewtonRaphsonInvocable<F, DF, T>
         constexpr T resolve(const T& init, const T& sigma = T{}) const
         {
             if (sigma < 0)
                 throw std::invalid_argument("Argment sigma cannot have a value less than zero.");
+            return solve(init, step_tolerance<T>{sigma}).value;
+        }
 
-            T x = init;
-            while (true) {
-                // ニュートン法の次の値を算出
-                const T before_x = x;
-                x -= func(x) / d_func(x);
-
-                // 誤差の範囲を判定
-                const T diff = x - before_x;
-                const T diff_abs = (std::max)(diff, -diff);
-                if (diff_abs <= sigma)
-                    break;
+    private:
+        // 関数値と微分係数を算出
+        template <class T>
+        constexpr dual<T> evaluate(const T& x) const
+        {
+            if constexpr (std::same_as<DF, _numerical_calc_impl::auto_derivative>)
+                return dual<T>{func(dual<T>::variable(x))};
+            else {
+                const T fx = func(x);
+                // 関数値がゼロの場合、導関数は使用しないため評価しない
+                return dual<T>{fx, fx == 0 ? T{} : T{d_func(x)}};
             }
-            return x;
         }
     };
 }
@@ -0,0 +1,145 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_NUMERICAL_CALC_NEWTON_RAPHSON_BATCH_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_NUMERICAL_CALC_NEWTON_RAPHSON_BATCH_HPP
+
+#include <span>
+#include <array>
+#include <stdexcept>
+#include TUNUM_COMMON_INCLUDE(concepts.hpp)
+#include TUNUM_COMMON_INCLUDE(numerical_calc/solver_result.hpp)
+
+namespace tunum
+{
+    // ------------------------------------
+    // 複数の独立した方程式に対するニュートン法
+    // パラメータのみが異なる同一の方程式を、lane_width個ずつまとめて同じ回数だけ反復する
+    // 収束済みのレーンは値を更新しないのみで評価は継続し、要素ごとの分岐を含まないため、
+    // 関数がインライン展開可能であればコンパイラによるベクトル化が可能
+    // ------------------------------------
+
+    template <class F, class DF>
+    struct newton_raphson_batch
+    {
+        // 同時に反復するレーン数
+        static constexpr std::size_t lane_width = 8;
+
+        // 近似対象の関数(値, パラメータ)
+        F func;
+        // func を値について微分した関数(値, パラメータ)
+        DF d_func;
+
+        constexpr newton_raphson_batch(F&& f, DF&& df) noexcept
+            : func(f)
+            , d_func(df)
+        {}
+
+        constexpr newton_raphson_batch(const F& f, const DF& df) noexcept
+            : func(f)
+            , d_func(df)
+        {}
+
+        // 各パラメータについて関数の近似値を算出する
+        // @param params 各方程式のパラメータ
+        // @param values 初期値を渡し、近似値が格納される
+        // @param policy 収束判定の方針
+        // @param max_iteration 反復回数の上限
+        template <TuArithmetic T, TuConvergencePolicy<T> PolicyT = step_tolerance<T>>
+        requires (TuArithmeticInvocable<F, T, T, T> && TuArithmeticInvocable<DF, T, T, T>)
+        constexpr batch_solver_result solve(
+            std::span<const std::type_identity_t<T>> params,
+            std::span<T> values,
+            const PolicyT& policy = {},
+            std::size_t max_iteration = default_max_iteration
+        ) const
+        { return solve_impl<false>(params, values, {}, policy, max_iteration); }
+
+        // 各パラメータについて関数の近似値を算出し、要素ごとの収束可否をconvergedへ格納する
+        // @param params 各方程式のパラメータ
+        // @param values 初期値を渡し、近似値が格納される
+        // @param converged 要素ごとの収束可否
+        // @param policy 収束判定の方針
+        // @param max_iteration 反復回数の上限
+        template <TuArithmetic T, TuConvergencePolicy<T> PolicyT = step_tolerance<T>>
+        requires (TuArithmeticInvocable<F, T, T, T> && TuArithmeticInvocable<DF, T, T, T>)
+        constexpr batch_solver_result solve(
+            std::span<const std::type_identity_t<T>> params,
+            std::span<T> values,
+            std::span<bool> converged,
+            const PolicyT& policy = {},
+            std::size_t max_iteration = default_max_iteration
+        ) const
+        { return solve_impl<true>(params, values, converged, policy, max_iteration); }
+
+    private:
+        template <bool IsElementwise, class T, class PolicyT>
+        constexpr batch_solver_result solve_impl(
+            std::span<const T> params,
+            std::span<T> values,
+            std::span<bool> converged,
+            const PolicyT& policy,
+            std::size_t max_iteration
+        ) const
+        {
+            if (params.size() != values.size())
+                throw std::invalid_argument("Sizes of 'params' and 'values' are different.");
+            if (IsElementwise && converged.size() != values.size())
+                throw std::invalid_argument("Size of 'converged' is different.");
+
+            auto result = batch_solver_result{};
+            for (std::size_t head = 0; head < values.size(); head += lane_width) {
+                const auto lanes = (std::min)(lane_width, values.size() - head);
+
+                // 端数のレーンは、先頭の要素で埋めたうえで終了済みとして扱う
+                std::array<T, lane_width> x = {}, p = {}, before_x = {};
+                std::array<bool, lane_width> is_active = {}, is_converged = {};
+                for (std::size_t l = 0; l < lane_width; l++) {
+                    const auto i = head + (l < lanes ? l : 0);
+                    x[l] = before_x[l] = values[i];
+                    p[l] = params[i];
+                    is_active[l] = l < lanes;
+                }
+
+                std::size_t iterations = 0;
+                while (iterations < max_iteration && any(is_active)) {
+                    iterations++;
+                    for (std::size_t l = 0; l < lane_width; l++) {
+                        const T fx = func(x[l], p[l]);
+                        const T dfx = d_func(x[l], p[l]);
+                        // 導関数がゼロのレーンはゼロ除算を避け、収束せずに終了
+                        // (単一の方程式の場合と同様に、関数値がゼロであれば導関数によらず収束とする)
+                        const bool is_stalled = dfx == 0;
+                        const T next = x[l] - fx / (is_stalled ? T{1} : dfx);
+                        const bool is_done = fx == 0 || policy(T{next - x[l]}, fx);
+                        // 2周期の振動(隣接する値同士であれば収束とする)
+                        const bool is_cycled = iterations > 1 && next == before_x[l];
+                        const bool is_adjacent = is_cycled && _numerical_calc_impl::is_adjacent(x[l], next);
+
+                        const bool is_update = is_active[l] & (!is_stalled | (fx == 0));
+                        is_converged[l] = is_converged[l] | (is_update & (is_done | is_adjacent));
+                        is_active[l] = is_update & !is_done & !is_cycled;
+                        before_x[l] = is_update ? x[l] : before_x[l];
+                        x[l] = is_update ? (fx == 0 ? x[l] : next) : x[l];
+                    }
+                }
+
+                for (std::size_t l = 0; l < lanes; l++) {
+                    values[head + l] = x[l];
+                    if constexpr (IsElementwise)
+                        converged[head + l] = is_converged[l];
+                    result.converged_count += is_converged[l];
+                }
+                result.iterations = (std::max)(result.iterations, iterations);
+            }
+            return result;
+        }
+
+        static constexpr bool any(const std::array<bool, lane_width>& flags) noexcept
+        {
+            bool result = false;
+            for (const auto flag : flags)
+                result |= flag;
+            return result;
+        }
+    };
+}
+
+#endif
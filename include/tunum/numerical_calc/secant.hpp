@@ -0,0 +1,67 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_NUMERICAL_CALC_SECANT_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_NUMERICAL_CALC_SECANT_HPP
+
+#include TUNUM_COMMON_INCLUDE(concepts.hpp)
+#include TUNUM_COMMON_INCLUDE(numerical_calc/solver_result.hpp)
+
+namespace tunum
+{
+    // ------------------------------------
+    // 割線法
+    // 導関数の代わりに直前2点を通る直線の傾きを用いる(反復1回につき関数の評価は1回)
+    // ------------------------------------
+
+    template <class F>
+    struct secant
+    {
+        // 近似対象の関数
+        F func;
+
+        constexpr secant(F&& f) noexcept
+            : func(f)
+        {}
+
+        constexpr secant(const F& f) noexcept
+            : func(f)
+        {}
+
+        // 関数の近似値を算出する
+        // 2点の関数値が等しくなった場合は、その時点で打ち切る
+        // @param init0 1つ目の初期値
+        // @param init1 2つ目の初期値
+        // @param policy 収束判定の方針
+        // @param max_iteration 反復回数の上限
+        template <TuArithmetic T, TuConvergencePolicy<T> PolicyT = step_tolerance<T>>
+        requires TuArithmeticInvocable<F, T, T>
+        constexpr solver_result<T> solve(
+            const T& init0,
+            const T& init1,
+            const PolicyT& policy = {},
+            std::size_t max_iteration = default_max_iteration
+        ) const
+        {
+            T before_x = init0;
+            T before_fx = func(init0);
+            T x = init1;
+            for (std::size_t i = 1; i <= max_iteration; i++) {
+                const T fx = func(x);
+                if (fx == 0)
+                    return {x, i, true};
+                if (fx == before_fx)
+                    return {x, i - 1, false};
+
+                const T next = x - fx * (x - before_x) / (fx - before_fx);
+                if (policy(T{next - x}, fx))
+                    return {next, i, true};
+                if (next == before_x)
+                    return {next, i, _numerical_calc_impl::is_adjacent(x, next)};
+                before_x = x;
+                before_fx = fx;
+                x = next;
+            }
+            return {x, max_iteration, false};
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,120 @@
+#ifndef TUNUM_INCLUDE_GUARD_TUNUM_NUMERICAL_CALC_SOLVER_RESULT_HPP
+#define TUNUM_INCLUDE_GUARD_TUNUM_NUMERICAL_CALC_SOLVER_RESULT_HPP
+
+#include <cstddef>
+#include <algorithm>
+#include TUNUM_COMMON_INCLUDE(concepts.hpp)
+
+namespace tunum
+{
+    // ------------------------------------
+    // 求解の結果と収束判定
+    // ------------------------------------
+
+    // 反復回数の上限の既定値
+    inline constexpr std::size_t default_max_iteration = 1000;
+
+    // 反復法による求解の結果
+    template <class T>
+    struct solver_result
+    {
+        // 最終的な近似値
+        T value;
+        // 実際に行った反復回数
+        std::size_t iterations;
+        // 収束したかどうか(falseの場合は反復回数の上限到達、または反復の継続不可)
+        bool converged;
+    };
+
+    // 複数の方程式をまとめて解いた結果
+    struct batch_solver_result
+    {
+        // 実際に行った反復回数(全方程式中の最大)
+        std::size_t iterations;
+        // 収束した方程式の数
+        std::size_t converged_count;
+    };
+
+    // 反復の差分による収束判定
+    // 1回の反復での変化量の絶対値がsigma以下で収束とする
+    template <TuArithmetic T>
+    struct step_tolerance
+    {
+        T sigma = {};
+
+        // @param step 1回の反復での変化量
+        // @param residual 反復前の値での関数値
+        constexpr bool operator()(const T& step, const T&) const
+        { return (std::max)(step, T{-step}) <= sigma; }
+    };
+
+    // 関数値による収束判定
+    // 関数値の絶対値がsigma以下で収束とする
+    template <TuArithmetic T>
+    struct residual_tolerance
+    {
+        T sigma = {};
+
+        // @param step 1回の反復での変化量
+        // @param residual 反復前の値での関数値
+        constexpr bool operator()(const T&, const T& residual) const
+        { return (std::max)(residual, T{-residual}) <= sigma; }
+    };
+
+    // 収束判定の方針
+    // (変化量, 関数値)を受け取り、収束したかどうかを返す関数オブジェクト
+    template <class PolicyT, class T>
+    concept TuConvergencePolicy = std::is_invocable_r_v<bool, const PolicyT&, const T&, const T&>;
+}
+
+namespace tunum::_numerical_calc_impl
+{
+    // 1回の反復の結果
+    template <class T>
+    struct iteration_step
+    {
+        // 次の値
+        T next;
+        // 反復前の値での関数値
+        T residual;
+        // 次の値を算出できたかどうか(導関数がゼロ等で算出できない場合はfalse)
+        bool is_valid;
+    };
+
+    // 2つの値が隣接しているかどうか(間に表現可能な値が存在しない)
+    template <class T>
+    constexpr bool is_adjacent(const T& a, const T& b)
+    {
+        const T mid = a + (b - a) / 2;
+        return mid == a || mid == b;
+    }
+
+    // 1点から次の値を求める反復法の共通処理
+    // 収束判定に加え、隣接する2値間の振動を検出した場合も収束とする
+    // @param init 初期値
+    // @param step 現在の値からiteration_stepを算出する関数
+    // @param policy 収束判定の方針
+    // @param max_iteration 反復回数の上限
+    template <class T, class StepF, class PolicyT>
+    constexpr solver_result<T> iterate(const T& init, StepF step, const PolicyT& policy, std::size_t max_iteration)
+    {
+        T x = init;
+        T before_x = init;
+        for (std::size_t i = 1; i <= max_iteration; i++) {
+            const iteration_step<T> s = step(x);
+            if (!s.is_valid)
+                return {x, i - 1, false};
+            if (policy(T{s.next - x}, s.residual))
+                return {s.next, i, true};
+
+            // 2周期の振動(隣接する値同士であれば、これ以上精度が上がらないため収束とする)
+            if (i > 1 && s.next == before_x)
+                return {s.next, i, is_adjacent(x, s.next)};
+            before_x = x;
+            x = s.next;
+        }
+        return {x, max_iteration, false};
+    }
+}
+
+#endif
@@ -1,3 +1,4 @@
+#include <cstring>
 #include <gtest/gtest.h>
 #include <tunum/floating.hpp>
 
@@ -265,23 +266,21 @@ TEST(TunumFloatingTest, AddTest)
     EXPECT_FALSE(inf_minus_inf2.has_overflow());
     EXPECT_FALSE(inf_minus_inf2.has_underflow());
 
-    // アンダーフロー
+    // 非正規化数となる和は正確であるため、アンダーフローとしない
     constexpr auto udf_1 = tunum::add(float_info.get_min(), float_info.get_denormalized_min(true));
     EXPECT_TRUE(tunum::floating_std_info{udf_1}.is_denormalized());
     EXPECT_TRUE((float)udf_1 > 0);
-    EXPECT_TRUE(udf_1.has_inexact());
-    EXPECT_FALSE(udf_1.has_divbyzero());
-    EXPECT_FALSE(udf_1.has_invalid());
-    EXPECT_FALSE(udf_1.has_overflow());
-    EXPECT_TRUE(udf_1.has_underflow());
+    EXPECT_FALSE(udf_1.has_fexcept());
     constexpr auto udf_2 = tunum::add(float_info.get_denormalized_max(true), float_info.get_denormalized_min());
     EXPECT_TRUE(tunum::floating_std_info{udf_2}.is_denormalized());
     EXPECT_TRUE((float)udf_2 < 0);
-    EXPECT_TRUE(udf_2.has_inexact());
-    EXPECT_FALSE(udf_2.has_divbyzero());
-    EXPECT_FALSE(udf_2.has_invalid());
-    EXPECT_FALSE(udf_2.has_overflow());
-    EXPECT_TRUE(udf_2.has_underflow());
+    EXPECT_FALSE(udf_2.has_fexcept());
+
+    // 丸め誤差による不正確
+    constexpr auto inexact = tunum::add(1.f, float_info.get_denormalized_min());
+    EXPECT_EQ((float)inexact, 1.f);
+    EXPECT_TRUE(inexact.has_inexact());
+    EXPECT_FALSE(inexact.has_underflow());
 
     // オーバーフロー(本来有限数になるはずだが、型で表現可能な値を逸脱することによる無限大発生)
     // もうちょい境界チェックしたほうが良いかもだがめんどいのでパス。
@@ -391,8 +390,12 @@ TEST(TunumFloatingTest, MulTest)
     EXPECT_TRUE(tunum::floating_std_info{arg_inf_nan}.is_nan());
     EXPECT_FALSE(arg_inf_nan.has_fexcept());
 
+    // 結果が正確な非正規化数の場合はアンダーフローとしない
+    constexpr auto exact_denorm = tunum::mul(0.5f, float_info.get_min());
+    EXPECT_TRUE(tunum::floating_std_info{exact_denorm}.is_denormalized());
+    EXPECT_FALSE(exact_denorm.has_fexcept());
     // 結果が非正規化数のアンダーフロー
-    constexpr auto udf_1 = tunum::mul(0.5f, float_info.get_min());
+    constexpr auto udf_1 = tunum::mul(0.75f, float_info.get_denormalized_min() * 3);
     EXPECT_TRUE(tunum::floating_std_info{udf_1}.is_denormalized());
     EXPECT_TRUE(udf_1 > 0);
     EXPECT_TRUE(udf_1.has_inexact());
@@ -456,7 +459,7 @@ TEST(TunumFloatingTest, DivTest)
     constexpr auto arg_zero_zero = tunum::div(0.f, 0.f);
     EXPECT_TRUE(tunum::floating_std_info{arg_zero_zero}.is_nan());
     EXPECT_FALSE(arg_zero_zero.has_inexact());
-    EXPECT_TRUE(arg_zero_zero.has_divbyzero());
+    EXPECT_FALSE(arg_zero_zero.has_divbyzero());
     EXPECT_TRUE(arg_zero_zero.has_invalid());
     EXPECT_FALSE(arg_zero_zero.has_overflow());
     EXPECT_FALSE(arg_zero_zero.has_underflow());
@@ -497,8 +500,12 @@ TEST(TunumFloatingTest, DivTest)
     EXPECT_TRUE(tunum::floating_std_info{arg_zero_nan}.is_nan());
     EXPECT_FALSE(arg_zero_nan.has_fexcept());
 
+    // 結果が正確な非正規化数の場合はアンダーフローとしない
+    constexpr auto exact_denorm = tunum::div(float_info.get_min(), 2.f);
+    EXPECT_TRUE(tunum::floating_std_info{exact_denorm}.is_denormalized());
+    EXPECT_FALSE(exact_denorm.has_fexcept());
     // 結果が非正規化数のアンダーフロー
-    constexpr auto udf_1 = tunum::div(float_info.get_min(), 2.f);
+    constexpr auto udf_1 = tunum::div(float_info.get_min(), 3.f);
     EXPECT_TRUE(tunum::floating_std_info{udf_1}.is_denormalized());
     EXPECT_TRUE(udf_1 > 0);
     EXPECT_TRUE(udf_1.has_inexact());
@@ -643,3 +650,404 @@ TEST(TunumFloatingTest, RaiseFexceptionTest)
     // アンダーフローによる例外の発生
     EXPECT_THROW(1 / udf_ovf_val_1, std::underflow_error);
 }
+
+TEST(TunumFloatingTest, RuntimeFexceptionTest)
+{
+    // 実行時はハードウェアの浮動小数点例外を採用する
+    // 定数式とならないよう、値は実行時に生成する
+    const auto double_info = tunum::floating_std_info{0.};
+    auto max_v = tunum::fe_holder{double_info.get_max()};
+    auto one_v = tunum::fe_holder{1.};
+    auto zero_v = tunum::fe_holder{0.};
+
+    std::fexcept_t before_e = {};
+    std::fegetexceptflag(&before_e, FE_ALL_EXCEPT);
+
+    // 通常の演算結果は定数式と一致
+    const auto add_1 = one_v + 2.5;
+    const auto sub_1 = one_v - 2.5;
+    const auto mul_1 = one_v * 2.5;
+    const auto div_1 = one_v / 2.;
+    EXPECT_EQ(add_1, 3.5);
+    EXPECT_EQ(sub_1, -1.5);
+    EXPECT_EQ(mul_1, 2.5);
+    EXPECT_EQ(div_1, 0.5);
+    EXPECT_FALSE(add_1.has_fexcept());
+    EXPECT_FALSE(div_1.has_fexcept());
+
+    // オーバーフロー
+    const auto ovf_1 = max_v + max_v;
+    EXPECT_TRUE(tunum::floating_std_info{ovf_1}.is_infinity());
+    EXPECT_TRUE(ovf_1.has_overflow());
+    EXPECT_TRUE(ovf_1.has_inexact());
+    const auto ovf_2 = max_v * 2;
+    EXPECT_TRUE(ovf_2.has_overflow());
+
+    // ゼロ除算、不正な演算
+    const auto div_by_zero = one_v / zero_v;
+    EXPECT_TRUE(tunum::floating_std_info{div_by_zero}.is_infinity());
+    EXPECT_TRUE(div_by_zero.has_divbyzero());
+    const auto invalid = (max_v + max_v) - (max_v + max_v);
+    EXPECT_TRUE(tunum::floating_std_info{invalid}.is_nan());
+    EXPECT_TRUE(invalid.has_invalid());
+    EXPECT_TRUE(invalid.has_overflow());
+
+    // アンダーフロー
+    const auto udf = one_v / max_v;
+    EXPECT_TRUE(tunum::floating_std_info{udf}.is_denormalized());
+    EXPECT_TRUE(udf.has_underflow());
+
+    // 演算前に立っていた浮動小数点例外は消えない
+    std::fexcept_t after_e = {};
+    std::fegetexceptflag(&after_e, FE_ALL_EXCEPT);
+    EXPECT_EQ(before_e & after_e & FE_ALL_EXCEPT, before_e & FE_ALL_EXCEPT);
+}
+
+TEST(TunumFloatingTest, RuntimeFexceptionPredictionTest)
+{
+    // 引数と結果から求めた浮動小数点例外が、ハードウェアの浮動小数点例外と一致すること
+    // また、判定のための演算がハードウェアへ余分な浮動小数点例外を立てないこと
+    const auto expect_same_as_hardware = []<class T>(std::type_identity<T>) {
+        using limits = std::numeric_limits<T>;
+        const T eps = limits::epsilon();
+        const T min_normal = (limits::min)();
+        // 定数式にならないよう、volatileを経由して値を生成
+        volatile T one_src = 1;
+        const T one = one_src;
+        std::vector<T> values{
+            0, -one * 0, one, -1.5, 3, one / 10, one / 3, one + eps, one - eps / 2,
+            (limits::max)(), -(limits::max)(), min_normal, -min_normal, min_normal * (1 - eps),
+            limits::denorm_min(), 3 * limits::denorm_min(), std::ldexp(one, limits::max_exponent / 2),
+            std::ldexp(one, limits::min_exponent / 2), limits::infinity(), -limits::infinity(), limits::quiet_NaN()
+        };
+        // 積が正規化数の最小値の前後となる値
+        std::uint64_t seed = 12345;
+        for (int i = 0; i < 40; ++i) {
+            seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+            const auto mantissa = 1 + static_cast<T>(seed >> 11) / static_cast<T>(1ull << 53);
+            values.push_back(std::ldexp((seed >> 10) & 1 ? mantissa : -mantissa, (limits::min_exponent - 2) / 2));
+        }
+
+        const auto hardware_fexcepts = [] {
+            return tunum::compress_fexcept(static_cast<std::fexcept_t>(std::fetestexcept(FE_ALL_EXCEPT)));
+        };
+        const auto expect_same = [&](T a, T b, auto op) {
+            volatile T va = a, vb = b;
+            std::feclearexcept(FE_ALL_EXCEPT);
+            volatile T expected = op(T{va}, T{vb});
+            const auto expected_e = hardware_fexcepts();
+
+            std::feclearexcept(FE_ALL_EXCEPT);
+            const auto actual = op(tunum::fe_holder<T>{a}, tunum::fe_holder<T>{b});
+            const auto raised_e = hardware_fexcepts();
+            if (std::isnan(expected))
+                EXPECT_TRUE(std::isnan(actual.value));
+            else
+                EXPECT_EQ(T{expected}, actual.value);
+            EXPECT_EQ(tunum::compress_fexcept(actual.fexcepts), expected_e) << a << ", " << b;
+            EXPECT_EQ(raised_e, expected_e) << a << ", " << b;
+        };
+        for (const auto a : values)
+            for (const auto b : values) {
+                expect_same(a, b, [](auto l, auto r) { return l + r; });
+                expect_same(a, b, [](auto l, auto r) { return l - r; });
+                expect_same(a, b, [](auto l, auto r) { return l * r; });
+                expect_same(a, b, [](auto l, auto r) { return l / r; });
+            }
+        std::feclearexcept(FE_ALL_EXCEPT);
+    };
+    expect_same_as_hardware(std::type_identity<float>{});
+    expect_same_as_hardware(std::type_identity<double>{});
+}
+
+TEST(TunumFloatingTest, ConstantRuntimeFexceptionTest)
+{
+    // 同じ式の浮動小数点例外が、定数式と実行時で一致すること
+    using limits = std::numeric_limits<double>;
+    constexpr auto inf = limits::infinity();
+    constexpr auto min_normal = (limits::min)();
+    constexpr auto denorm_min = limits::denorm_min();
+    const auto expect_same = [](const auto& constant, auto op, double a, double b, std::fexcept_t expected_e) {
+        // 定数式にならないよう、volatileを経由して値を渡す
+        volatile double va = a, vb = b;
+        const auto runtime = op(double{va}, double{vb});
+        EXPECT_EQ(constant.fexcepts, expected_e) << a << ", " << b;
+        EXPECT_EQ(runtime.fexcepts, expected_e) << a << ", " << b;
+        std::feclearexcept(FE_ALL_EXCEPT);
+    };
+    const auto add = [](double l, double r) { return tunum::add(l, r); };
+    const auto sub = [](double l, double r) { return tunum::sub(l, r); };
+    const auto mul = [](double l, double r) { return tunum::mul(l, r); };
+    const auto div = [](double l, double r) { return tunum::div(l, r); };
+
+    // 0 / 0, 有限数 / 0, 無限大 - 無限大
+    constexpr auto zero_div_zero = tunum::div(0., 0.);
+    expect_same(zero_div_zero, div, 0., 0., FE_INVALID);
+    constexpr auto one_div_zero = tunum::div(1., -0.);
+    expect_same(one_div_zero, div, 1., -0., FE_DIVBYZERO);
+    constexpr auto inf_sub_inf = tunum::sub(inf, inf);
+    expect_same(inf_sub_inf, sub, inf, inf, FE_INVALID);
+
+    // 正確な非正規化数
+    constexpr auto exact_mul = tunum::mul(0x1p-1070, 1.);
+    expect_same(exact_mul, mul, 0x1p-1070, 1., 0);
+    constexpr auto exact_div = tunum::div(min_normal, 4.);
+    expect_same(exact_div, div, min_normal, 4., 0);
+    constexpr auto exact_add = tunum::add(min_normal, -denorm_min);
+    expect_same(exact_add, add, min_normal, -denorm_min, 0);
+
+    // 不正確な非正規化数、ゼロ
+    constexpr auto inexact_mul = tunum::mul(0x1p-1070, 0.7);
+    expect_same(inexact_mul, mul, 0x1p-1070, 0.7, FE_UNDERFLOW | FE_INEXACT);
+    constexpr auto inexact_div = tunum::div(min_normal, 3.);
+    expect_same(inexact_div, div, min_normal, 3., FE_UNDERFLOW | FE_INEXACT);
+    constexpr auto zero_mul = tunum::mul(denorm_min, 0.5);
+    expect_same(zero_mul, mul, denorm_min, 0.5, FE_UNDERFLOW | FE_INEXACT);
+
+    // 不正確な正規化数
+    constexpr auto inexact_normal = tunum::div(1., 3.);
+    expect_same(inexact_normal, div, 1., 3., FE_INEXACT);
+    constexpr auto inexact_add = tunum::add(1., 0x1p-60);
+    expect_same(inexact_add, add, 1., 0x1p-60, FE_INEXACT);
+
+    // 丸め前は正規化数の最小値を下回り、丸め後は正規化数の最小値となる
+    // (アンダーフローの判定を丸め後に行う処理系では、不正確のみ)
+    constexpr auto below_min = min_normal - denorm_min;
+    constexpr auto round_to_min = tunum::mul(below_min, 1 + limits::epsilon());
+    expect_same(round_to_min, mul, below_min, 1 + limits::epsilon(),
+        tunum::_fe_predict_impl::is_tininess_after_rounding ? FE_INEXACT : FE_UNDERFLOW | FE_INEXACT);
+}
+
+TEST(TunumFloatingTest, FeScopeTest)
+{
+    // 定数式にならないよう、volatileを経由して値を生成
+    volatile auto max_src = std::numeric_limits<double>::max();
+    volatile auto one_src = 1.;
+    volatile auto zero_src = 0.;
+    const double max_v = max_src;
+    const double one_v = one_src;
+    const double zero_v = zero_src;
+
+    // スコープ内の例外がまとめて収集される
+    auto e = std::fexcept_t{};
+    {
+        auto scope = tunum::fe_scope{e};
+        volatile auto sum = 0.;
+        for (int i = 0; i < 1000; ++i)
+            sum = sum + one_v / 3.;
+        EXPECT_FALSE(scope.has_fexcept(FE_OVERFLOW));
+        volatile auto ovf = max_v * 2.;
+        EXPECT_TRUE(scope.has_fexcept(FE_OVERFLOW));
+        const auto held = scope.hold(double(ovf));
+        EXPECT_TRUE(held.has_overflow());
+        EXPECT_FALSE(held.has_divbyzero());
+    }
+    EXPECT_TRUE(e & FE_OVERFLOW);
+    EXPECT_TRUE(e & FE_INEXACT);
+    EXPECT_FALSE(e & FE_DIVBYZERO);
+
+    // 指定した例外はスコープの終了時に送出される
+    const auto raise_div_by_zero = [&] {
+        auto scope = tunum::fe_scope<FE_DIVBYZERO>{};
+        volatile auto v = one_v / zero_v;
+        EXPECT_TRUE(std::isinf(v));
+    };
+    EXPECT_THROW(raise_div_by_zero(), std::range_error);
+
+    // 送出対象外の例外は投げない
+    const auto no_raise = [&] {
+        auto scope = tunum::fe_scope<FE_DIVBYZERO>{};
+        volatile auto v = max_v * max_v;
+        EXPECT_TRUE(std::isinf(v));
+    };
+    EXPECT_NO_THROW(no_raise());
+
+    // closeで明示的に閉じる
+    auto scope = tunum::fe_scope<FE_OVERFLOW>{};
+    volatile auto v = one_v / zero_v;
+    EXPECT_TRUE(std::isinf(v));
+    EXPECT_TRUE(scope.close() & FE_DIVBYZERO);
+}
+
+TEST(TunumFloatingTest, FeSpanTest)
+{
+    using limits = std::numeric_limits<double>;
+
+    // 全ての値の組み合わせについて、要素ごとの結果と浮動小数点例外が
+    // 実行時のスカラーの演算(long doubleはfe_holderの演算に対応しないため、ハードウェアの浮動小数点例外)と一致すること
+    const auto expect_same_as_scalar = []<class T>(std::type_identity<T>) {
+        using limits = std::numeric_limits<T>;
+        const T eps = limits::epsilon();
+        const T min_normal = (limits::min)();
+        // 定数式にならないよう、volatileを経由して値を生成
+        volatile T one_src = 1;
+        const T one = one_src;
+        const auto values = std::vector<T>{
+            0, -one * 0, one, -1.5, 3, one / 10, one / 3, one + eps, one - eps / 2,
+            (limits::max)(), -(limits::max)(), min_normal, -min_normal * T(1.5), min_normal * (1 - eps),
+            limits::denorm_min(), std::ldexp(one, limits::max_exponent / 2), std::ldexp(one, limits::min_exponent / 2),
+            limits::infinity(), -limits::infinity(), limits::quiet_NaN()
+        };
+        auto arg1 = std::vector<T>{}, arg2 = std::vector<T>{};
+        for (const auto a : values)
+            for (const auto b : values) {
+                arg1.push_back(a);
+                arg2.push_back(b);
+            }
+        const auto n = arg1.size();
+
+        const auto expect_same = [&](auto span_fn, auto scalar_fn) {
+            auto result = std::vector<T>(n);
+            auto fexcepts = std::vector<tunum::fe_compact_t>(n);
+            const auto total = span_fn(std::span<const T>{arg1}, std::span<const T>{arg2}, std::span{result}, std::span{fexcepts});
+            auto expected_total = tunum::fe_compact_t{};
+            for (std::size_t i = 0; i < n; ++i) {
+                auto expected = T{};
+                auto expected_e = tunum::fe_compact_t{};
+                if constexpr (std::is_same_v<T, long double>) {
+                    volatile T a = arg1[i], b = arg2[i];
+                    std::feclearexcept(FE_ALL_EXCEPT);
+                    volatile T r = scalar_fn(T{a}, T{b});
+                    expected = r;
+                    expected_e = tunum::compress_fexcept(static_cast<std::fexcept_t>(std::fetestexcept(FE_ALL_EXCEPT)));
+                }
+                else {
+                    const auto v = scalar_fn(tunum::fe_holder<T>{arg1[i]}, tunum::fe_holder<T>{arg2[i]});
+                    expected = v.value;
+                    expected_e = tunum::compress_fexcept(v.fexcepts);
+                }
+                if (std::isnan(expected))
+                    EXPECT_TRUE(std::isnan(result[i])) << arg1[i] << ", " << arg2[i];
+                else
+                    EXPECT_EQ(expected, result[i]) << arg1[i] << ", " << arg2[i];
+                EXPECT_EQ(expected_e, fexcepts[i]) << arg1[i] << ", " << arg2[i];
+                expected_total |= expected_e;
+            }
+            EXPECT_EQ(tunum::expand_fexcept(expected_total), total);
+        };
+        expect_same([](auto&&... args) { return tunum::fe_add(args...); }, [](auto l, auto r) { return l + r; });
+        expect_same([](auto&&... args) { return tunum::fe_sub(args...); }, [](auto l, auto r) { return l - r; });
+        expect_same([](auto&&... args) { return tunum::fe_mul(args...); }, [](auto l, auto r) { return l * r; });
+        expect_same([](auto&&... args) { return tunum::fe_div(args...); }, [](auto l, auto r) { return l / r; });
+        std::feclearexcept(FE_ALL_EXCEPT);
+    };
+    expect_same_as_scalar(std::type_identity<float>{});
+    expect_same_as_scalar(std::type_identity<double>{});
+    expect_same_as_scalar(std::type_identity<long double>{});
+
+    // 通常の丸めは不正確な結果、0 / 0 は不正な演算のみ
+    auto quotient = std::array<double, 2>{};
+    auto quotient_e = std::array<tunum::fe_compact_t, 2>{};
+    volatile auto zero_src = 0.;
+    const auto dividend = std::array{1., double(zero_src)};
+    const auto divisor = std::array{3., double(zero_src)};
+    tunum::fe_div(dividend, divisor, std::span{quotient}, std::span{quotient_e});
+    EXPECT_EQ(quotient_e[0], tunum::fe_compact_inexact);
+    EXPECT_EQ(quotient_e[1], tunum::fe_compact_invalid);
+
+    // 定数式ではfe_holderと同じソフトウェアによる検証を行う
+    constexpr auto constexpr_div = [] {
+        auto result = std::array<double, 2>{};
+        auto fexcepts = std::array<tunum::fe_compact_t, 2>{};
+        tunum::fe_div(std::array{1., 1.}, std::array{0., limits::max()}, std::span{result}, std::span{fexcepts});
+        return std::pair{result, fexcepts};
+    }();
+    constexpr auto constexpr_scalar_1 = tunum::div(1., 0.);
+    constexpr auto constexpr_scalar_2 = tunum::div(1., limits::max());
+    EXPECT_TRUE(std::isinf(constexpr_div.first[0]));
+    EXPECT_EQ(constexpr_div.second[0], tunum::compress_fexcept(constexpr_scalar_1.fexcepts));
+    EXPECT_EQ(constexpr_div.first[1], constexpr_scalar_2.value);
+    EXPECT_EQ(constexpr_div.second[1], tunum::compress_fexcept(constexpr_scalar_2.fexcepts));
+
+    // 集約された浮動小数点例外
+    auto result = std::array<double, 3>{};
+    const auto arg1 = std::array{1., limits::max(), 1.};
+    const auto arg2 = std::array{2., limits::max(), 0.};
+    const auto e1 = tunum::fe_add(arg1, arg2, std::span{result});
+    EXPECT_EQ(result[0], 3.);
+    EXPECT_TRUE(e1 & FE_OVERFLOW);
+    EXPECT_FALSE(e1 & FE_DIVBYZERO);
+    const auto e2 = tunum::fe_div(arg1, arg2, std::span{result});
+    EXPECT_EQ(result[0], .5);
+    EXPECT_TRUE(e2 & FE_DIVBYZERO);
+    EXPECT_FALSE(e2 & FE_OVERFLOW);
+
+    // 例外の送出は全要素の演算後
+    EXPECT_THROW(tunum::fe_div<FE_DIVBYZERO>(arg1, arg2, std::span{result}), std::range_error);
+    EXPECT_EQ(result[0], .5);
+    EXPECT_NO_THROW(tunum::fe_mul<FE_DIVBYZERO>(arg1, arg2, std::span{result}));
+    EXPECT_THROW(tunum::fe_add(arg1, std::span{arg2}.first(2), std::span{result}), std::invalid_argument);
+}
+
+TEST(TunumFloatingTest, FeHolderLayoutTest)
+{
+    // 値を先頭に置き、トリビアルコピー可能
+    static_assert(std::is_trivially_copyable_v<tunum::fe_holder<double, FE_OVERFLOW>>);
+    static_assert(offsetof(tunum::fe_holder<float>, value) == 0);
+
+    constexpr auto all_e = std::fexcept_t{FE_ALL_EXCEPT};
+    EXPECT_EQ(tunum::compress_fexcept(all_e), 0b11111);
+    EXPECT_EQ(tunum::expand_fexcept(tunum::compress_fexcept(all_e)), all_e);
+    EXPECT_EQ(tunum::expand_fexcept(tunum::compress_fexcept(FE_OVERFLOW | FE_INEXACT)), FE_OVERFLOW | FE_INEXACT);
+
+    constexpr auto v1 = tunum::fe_holder{1.5, FE_UNDERFLOW | FE_INEXACT};
+    EXPECT_EQ(v1.fexcepts, FE_UNDERFLOW | FE_INEXACT);
+    EXPECT_TRUE(v1.has_underflow());
+    EXPECT_FALSE(v1.has_overflow());
+
+    // バイト列のコピーで値と浮動小数点例外が復元される
+    auto src = std::array{v1, tunum::fe_holder{2.5}};
+    auto dst = std::array<tunum::fe_holder<double>, 2>{};
+    std::memcpy(dst.data(), src.data(), sizeof(src));
+    EXPECT_EQ(dst[0], 1.5);
+    EXPECT_TRUE(dst[0].has_underflow());
+    EXPECT_EQ(dst[1], 2.5);
+    EXPECT_FALSE(dst[1].has_fexcept());
+}
+
+TEST(TunumFloatingTest, FeVectorTest)
+{
+    using limits = std::numeric_limits<double>;
+
+    // 要素あたり sizeof(T) + 1byte
+    auto v = tunum::fe_vector<double>{tunum::fe_holder{1.5, FE_UNDERFLOW | FE_INEXACT}, 2.5, limits::max()};
+    // 書き込みは参照(代理オブジェクト)、読み込みはfe_holderの値で行う
+    const auto& cv = v;
+    EXPECT_EQ(v.size(), 3);
+    EXPECT_EQ(v.value_span().size_bytes() + v.fexcept_span().size_bytes(), v.size() * (sizeof(double) + 1));
+    EXPECT_EQ(cv[0], 1.5);
+    EXPECT_EQ(cv[0].fexcepts, FE_UNDERFLOW | FE_INEXACT);
+    EXPECT_FALSE(cv[1].has_fexcept());
+    EXPECT_EQ(v.fexcepts(), FE_UNDERFLOW | FE_INEXACT);
+
+    // 参照への代入は値と浮動小数点例外を書き込む
+    v[1] = cv[2] + cv[2];
+    EXPECT_TRUE(std::isinf(cv[1].value));
+    EXPECT_TRUE(cv[1].has_overflow());
+    v[2] = v[0];
+    EXPECT_EQ(cv[2], 1.5);
+    EXPECT_TRUE(cv[2].has_underflow());
+    EXPECT_THROW(v.at(3), std::out_of_range);
+
+    v.push_back(tunum::fe_holder{4., FE_DIVBYZERO});
+    EXPECT_EQ(v.size(), 4);
+    EXPECT_TRUE(cv[3].has_divbyzero());
+    v.pop_back();
+    v.resize(4);
+    EXPECT_EQ(cv[3], 0.);
+    EXPECT_FALSE(cv[3].has_fexcept());
+
+    // 配列の演算へそのまま渡せる
+    auto divisor = tunum::fe_vector<double>(4);
+    divisor[0] = 2.;
+    auto quotient = tunum::fe_vector<double>(4);
+    const auto& cq = quotient;
+    const auto e = tunum::fe_div(cv.value_span(), std::as_const(divisor).value_span(), quotient.value_span(), quotient.fexcept_span());
+    EXPECT_EQ(cq[0], .75);
+    EXPECT_FALSE(cq[0].has_fexcept());
+    EXPECT_TRUE(std::isinf(cq[1].value));
+    EXPECT_FALSE(cq[1].has_fexcept());
+    EXPECT_TRUE(cq[2].has_divbyzero());
+    EXPECT_TRUE(cq[3].has_invalid());
+    EXPECT_EQ(quotient.fexcepts(), e);
+}
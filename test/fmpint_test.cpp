@@ -1,5 +1,11 @@
 #include <gtest/gtest.h>
 #include <tunum/fmpint.hpp>
+#include <tunum/fmpint/reduce.hpp>
+#include <unordered_map>
+#include <vector>
+#include <array>
+#include <algorithm>
+#include <filesystem>
 
 using uint128_t_2 = tunum::fmpint<15, false>;
 using uint64_t_1 = tunum::fmpint<0, false>;
@@ -69,6 +75,24 @@ TEST(TunumFmpintTest, ConstructorTest)
     ASSERT_EQ(v10.upper, bit32_4);
     ASSERT_EQ(v11.upper, -5678);
     ASSERT_EQ(v11.lower, -5678);
+
+    // 符号ありで4倍以上のサイズへの変換は、下位の半分も符号拡張する
+    constexpr auto v12 = tunum::fmpint<64, true>{tunum::int128_t{-5}};
+    constexpr auto v13 = tunum::fmpint<64, true>{std::numeric_limits<tunum::int128_t>::min()};
+    ASSERT_EQ(v12, -5);
+    for (std::size_t i = 1; i < v12.data_length; i++)
+        ASSERT_EQ(v12[i], bit32_4);
+    ASSERT_EQ(v13, -(tunum::fmpint<64, true>{1} << 127));
+
+    // 64bitの符号ありの整数による初期化(上位32bitは値の上位をそのまま保持する)
+    constexpr auto v14 = tunum::fmpint<8, true>{std::int64_t{-0x1'2345'6789}};
+    constexpr auto v15 = tunum::int128_t{std::numeric_limits<std::int64_t>::min()};
+    ASSERT_EQ(v14.lower, static_cast<std::uint32_t>(-0x1'2345'6789));
+    ASSERT_EQ(v14.upper, static_cast<std::uint32_t>(-0x2));
+    ASSERT_EQ(v15.lower.lower, 0);
+    ASSERT_EQ(v15.lower.upper, 0x8000'0000u);
+    ASSERT_EQ(v15.upper.lower, bit32_4);
+    ASSERT_EQ(v15.upper.upper, bit32_4);
 }
 
 TEST(TunumFmpintTest, ElementAccessTest)
@@ -393,6 +417,14 @@ TEST(TunumFmpintTest, OperatorTest)
     EXPECT_EQ(v11[5], 0);
     EXPECT_EQ(v11[6], 0);
     EXPECT_EQ(v11[7], 0);
+    // 符号あり(組み込みの整数と同様に0方向へ丸める)
+    EXPECT_EQ(tunum::int128_t{-7} / 2, -3);
+    EXPECT_EQ(tunum::int128_t{-7} / -2, 3);
+    EXPECT_EQ(tunum::int128_t{7} % -2, 1);
+    // 符号ありの乗算でも中間値は符号拡張しない
+    constexpr auto v12 = tunum::int128_t{0xff80000000000000ull};
+    EXPECT_EQ(v12 * 3, v12 + v12 + v12);
+    EXPECT_EQ(v12 * 3 / 3, v12);
 }
 
 using namespace tunum::literals;
@@ -471,3 +503,889 @@ TEST(TunumFmpintTest, MemoryLayoutTest)
     constexpr auto integral_value_2 = std::bit_cast<uint64_t_2, std::uint64_t>(integral_value_1);
     EXPECT_EQ(integral_value_1, integral_value_2);
 }
+
+TEST(TunumFmpintTest, NumericLimitsTest)
+{
+    using int128_limits = std::numeric_limits<tunum::int128_t>;
+    using uint256_limits = std::numeric_limits<tunum::uint256_t>;
+    static_assert(int128_limits::is_specialized);
+    static_assert(int128_limits::is_signed && !uint256_limits::is_signed);
+    EXPECT_EQ(int128_limits::digits, 127);
+    EXPECT_EQ(uint256_limits::digits, 256);
+    // 組み込み整数と同じ
+    EXPECT_EQ(std::numeric_limits<uint64_t_2>::digits10, std::numeric_limits<std::uint64_t>::digits10);
+    EXPECT_EQ(int128_limits::digits10, 38);
+    EXPECT_EQ(uint256_limits::digits10, 77);
+
+    constexpr auto int128_max = int128_limits::max();
+    constexpr auto int128_min = int128_limits::min();
+    EXPECT_EQ(int128_max, ~tunum::uint128_t{} >> 1);
+    EXPECT_TRUE(int128_min < 0);
+    EXPECT_EQ(int128_min - 1, int128_max);
+    EXPECT_EQ(uint256_limits::min(), 0);
+    EXPECT_EQ(uint256_limits::max(), ~tunum::uint256_t{});
+}
+
+TEST(TunumFmpintTest, HashTest)
+{
+    constexpr auto hash_1 = tunum::hash_value(tunum::uint256_t{12345});
+    constexpr auto hash_2 = tunum::hash_value(tunum::uint128_t{12345});
+    constexpr auto hash_3 = tunum::hash_value(tunum::uint256_t{12345} << 128);
+    EXPECT_EQ(hash_1, hash_2);
+    EXPECT_NE(hash_1, hash_3);
+    EXPECT_EQ(tunum::hash_value(tunum::int256_t{-1}), tunum::hash_value(tunum::int128_t{-1}));
+    EXPECT_EQ(std::hash<tunum::uint256_t>{}(tunum::uint256_t{12345}), hash_1);
+    EXPECT_NE(tunum::hash_combine(hash_1, hash_3), tunum::hash_combine(hash_3, hash_1));
+    // 残る要素の先頭ビットが符号と異なる場合は、符号拡張として読み飛ばさない
+    const auto hash_int128 = std::hash<tunum::int128_t>{};
+    const auto hash_int256 = std::hash<tunum::int256_t>{};
+    EXPECT_NE(hash_int128(-(tunum::int128_t{1} << 64) + 5), hash_int128(tunum::int128_t{5}));
+    EXPECT_NE(hash_int128(tunum::int128_t{1} << 63), hash_int128(-(tunum::int128_t{1} << 63)));
+    EXPECT_NE(hash_int256(-(tunum::int256_t{1} << 64) + 5), hash_int256(tunum::int256_t{5}));
+    EXPECT_NE(hash_int256(tunum::int256_t{1} << 127), hash_int256(-(tunum::int256_t{1} << 127)));
+    EXPECT_EQ(hash_int256(-(tunum::int256_t{1} << 64) + 5), hash_int128(-(tunum::int128_t{1} << 64) + 5));
+    EXPECT_EQ(hash_int256(tunum::int256_t{1} << 63), hash_int128(tunum::int128_t{1} << 63));
+    EXPECT_EQ(hash_int256(-(tunum::int256_t{1} << 63)), hash_int128(-(tunum::int128_t{1} << 63)));
+
+    std::unordered_map<tunum::uint256_t, int> map{};
+    for (int i = 0; i < 1000; i++)
+        map[(tunum::uint256_t{i} << 200) + i] = i;
+    EXPECT_EQ(map.size(), 1000u);
+    EXPECT_EQ(map.at((tunum::uint256_t{999} << 200) + 999), 999);
+}
+
+TEST(TunumFmpintTest, FlatMapTest)
+{
+    tunum::fmpint_flat_map<32, int> map{};
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.find(tunum::uint256_t{1}), nullptr);
+
+    // 下位64bitが等しいキーを含む
+    for (int i = 0; i < 1000; i++)
+        map[(tunum::uint256_t{i % 10} << 192) + i / 10] = i;
+    EXPECT_EQ(map.size(), 1000u);
+    for (int i = 0; i < 1000; i++)
+        ASSERT_EQ(map.at((tunum::uint256_t{i % 10} << 192) + i / 10), i);
+    EXPECT_FALSE(map.contains(tunum::uint256_t{10} << 192));
+    EXPECT_THROW(map.at(tunum::uint256_t{10} << 192), std::out_of_range);
+
+    const auto [v, is_inserted] = map.try_emplace(tunum::uint256_t{0}, -1);
+    EXPECT_FALSE(is_inserted);
+    EXPECT_EQ(*v, 0);
+
+    // 削除後も、残りの要素が検索可能
+    for (int i = 0; i < 1000; i += 2)
+        ASSERT_TRUE(map.erase((tunum::uint256_t{i % 10} << 192) + i / 10));
+    EXPECT_FALSE(map.erase(tunum::uint256_t{0}));
+    EXPECT_EQ(map.size(), 500u);
+    for (int i = 0; i < 1000; i++)
+        ASSERT_EQ(map.contains((tunum::uint256_t{i % 10} << 192) + i / 10), i % 2 == 1);
+
+    int sum = 0;
+    map.for_each([&sum](const tunum::uint256_t&, int v) { sum += v; });
+    EXPECT_EQ(sum, 500 * 500);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains(tunum::uint256_t{1} << 192));
+}
+
+TEST(TunumFmpintTest, SortedIndexTest)
+{
+    std::vector<tunum::uint128_t> keys{};
+    for (int i = 0; i < 1000; i++)
+        keys.push_back((tunum::uint128_t{static_cast<std::uint32_t>(i * 7919 % 1000)} << 118) + i);
+    // 重複したキーは先に現れた位置
+    keys.push_back(keys[10]);
+
+    const auto index = tunum::fmpint_sorted_index<16>{keys};
+    EXPECT_EQ(index.size(), keys.size());
+    for (std::size_t i = 0; i < keys.size(); i++)
+        ASSERT_EQ(index.find(keys[i]), i == 1000 ? 10 : i);
+    EXPECT_EQ(index.find(tunum::uint128_t{1}), index.npos);
+    EXPECT_FALSE(index.contains(~tunum::uint128_t{}));
+    EXPECT_EQ(index.lower_bound(tunum::uint128_t{}), 0u);
+    EXPECT_EQ(index.lower_bound(~tunum::uint128_t{}), keys.size());
+
+    // 上位のビットが全て0のキー、内部表現に余りのある型
+    std::vector<tunum::uint256_t> small_keys{};
+    for (std::uint64_t i = 0; i < 1000; i++)
+        small_keys.push_back(tunum::uint256_t{i * 7919 % 1000 * 1000 + 5});
+    const auto small_index = tunum::fmpint_sorted_index<32>{small_keys};
+    for (std::size_t i = 0; i < small_keys.size(); i++)
+        ASSERT_EQ(small_index.find(small_keys[i]), i);
+    EXPECT_EQ(small_index.find(tunum::uint256_t{6}), small_index.npos);
+    EXPECT_EQ(small_index.lower_bound(tunum::uint256_t{}), 0u);
+    EXPECT_EQ(small_index.lower_bound(tunum::uint256_t{5}), 0u);
+    EXPECT_EQ(small_index.lower_bound(tunum::uint256_t{6}), 1u);
+    EXPECT_EQ(small_index.lower_bound(tunum::uint256_t{500'005}), 500u);
+    EXPECT_EQ(small_index.lower_bound(tunum::uint256_t{999'006}), 1000u);
+    EXPECT_EQ(small_index.lower_bound(tunum::uint256_t{1} << 200), 1000u);
+
+    std::vector<tunum::fmpint<24, false>> padded_keys{};
+    for (std::uint64_t i = 0; i < 300; i++)
+        padded_keys.push_back((tunum::fmpint<24, false>{i * 7 % 300} << 100) + i);
+    const auto padded_index = tunum::fmpint_sorted_index<24>{padded_keys};
+    for (std::size_t i = 0; i < padded_keys.size(); i++)
+        ASSERT_EQ(padded_index.find(padded_keys[i]), i);
+    EXPECT_FALSE(padded_index.contains(tunum::fmpint<24, false>{1}));
+
+    // 全て同じキー
+    const auto same_index = tunum::fmpint_sorted_index<16>{std::vector<tunum::uint128_t>(10, tunum::uint128_t{7})};
+    EXPECT_EQ(same_index.find(tunum::uint128_t{7}), 0u);
+    EXPECT_EQ(same_index.lower_bound(tunum::uint128_t{8}), 10u);
+    EXPECT_EQ(tunum::fmpint_sorted_index<16>{}.find(tunum::uint128_t{7}), tunum::fmpint_sorted_index<16>::npos);
+
+    constexpr auto constexpr_find = []() {
+        const std::array<tunum::uint128_t, 3> source = {tunum::uint128_t{3}, tunum::uint128_t{1}, tunum::uint128_t{2}};
+        return tunum::fmpint_sorted_index<16>{source}.find(tunum::uint128_t{2});
+    }();
+    EXPECT_EQ(constexpr_find, 2u);
+}
+
+TEST(TunumFmpintTest, RadixSortTest)
+{
+    // 線形合同法による疑似乱数
+    std::uint64_t seed = 12345;
+    const auto random = [&seed]() { return seed = seed * 6364136223846793005ull + 1442695040888963407ull; };
+
+    std::vector<tunum::uint256_t> unsigned_values(3000);
+    for (auto& v : unsigned_values)
+        v = (tunum::uint256_t{random()} << 192) + (tunum::uint256_t{random()} << 64) + random();
+    // 重複を含む
+    unsigned_values[1] = unsigned_values[0];
+    auto expected_unsigned = unsigned_values;
+    std::sort(expected_unsigned.begin(), expected_unsigned.end());
+
+    auto sorted_1 = unsigned_values;
+    tunum::radix_sort(std::span{sorted_1});
+    EXPECT_TRUE(sorted_1 == expected_unsigned);
+
+    auto sorted_2 = unsigned_values;
+    tunum::radix_sort<16>(std::span{sorted_2});
+    EXPECT_TRUE(sorted_2 == expected_unsigned);
+
+    auto sorted_3 = unsigned_values;
+    tunum::radix_sort_parallel(std::span{sorted_3}, 4);
+    EXPECT_TRUE(sorted_3 == expected_unsigned);
+
+    // 符号あり
+    std::vector<tunum::int128_t> signed_values(3000);
+    for (auto& v : signed_values)
+        v = tunum::int128_t{static_cast<std::int64_t>(random())} * static_cast<std::int64_t>(random() >> 40);
+    auto expected_signed = signed_values;
+    std::sort(expected_signed.begin(), expected_signed.end());
+
+    auto sorted_4 = signed_values;
+    tunum::radix_sort(std::span{sorted_4});
+    EXPECT_TRUE(sorted_4 == expected_signed);
+
+    auto sorted_5 = signed_values;
+    tunum::radix_sort_parallel<16>(std::span{sorted_5}, 3);
+    EXPECT_TRUE(sorted_5 == expected_signed);
+
+    // 16bitの桁で、基数より多い要素数(計数ソートを行う)と、区間ごとの要素数が少ない場合
+    std::vector<tunum::uint256_t> large_values(100000);
+    for (auto& v : large_values)
+        v = (tunum::uint256_t{random()} << 192) + (tunum::uint256_t{random()} << 128) + (tunum::uint256_t{random()} << 64) + random();
+    auto expected_large = large_values;
+    std::sort(expected_large.begin(), expected_large.end());
+
+    auto sorted_6 = large_values;
+    tunum::radix_sort<16>(std::span{sorted_6});
+    EXPECT_TRUE(sorted_6 == expected_large);
+
+    auto sorted_7 = large_values;
+    tunum::radix_sort_parallel<16>(std::span{sorted_7}, 1);
+    EXPECT_TRUE(sorted_7 == expected_large);
+
+    constexpr auto constexpr_sorted = []() {
+        std::array<tunum::int128_t, 4> values = {tunum::int128_t{3}, tunum::int128_t{-1}, tunum::int128_t{2}, tunum::int128_t{-5}};
+        tunum::radix_sort(std::span{values});
+        return values;
+    }();
+    EXPECT_EQ(constexpr_sorted[0], -5);
+    EXPECT_EQ(constexpr_sorted[1], -1);
+    EXPECT_EQ(constexpr_sorted[2], 2);
+    EXPECT_EQ(constexpr_sorted[3], 3);
+}
+
+TEST(TunumFmpintTest, ReduceTest)
+{
+    // 要素の最大値を多数加算し、要素の型では桁あふれする総和を求める
+    std::vector<tunum::uint128_t> values(5000, ~tunum::uint128_t{});
+    values[0] = 1;
+    auto expected_sum = tunum::uint256_t{1};
+    for (std::size_t i = 1; i < values.size(); i++)
+        expected_sum += tunum::uint256_t{~tunum::uint128_t{}};
+
+    EXPECT_EQ(tunum::reduce_sum(std::span{values}), expected_sum);
+    EXPECT_EQ(tunum::reduce_sum(tunum::execution::par, std::span{values}), expected_sum);
+    EXPECT_EQ(tunum::reduce_sum(tunum::execution::par_unseq, std::span{values}), expected_sum);
+    // 蓄積型の指定
+    EXPECT_EQ(tunum::reduce_sum<tunum::uint128_t>(tunum::execution::par, std::span{values}), tunum::uint128_t{expected_sum});
+
+    // 総乗
+    std::vector<tunum::int128_t> factors(4000, tunum::int128_t{1});
+    factors[10] = -3;
+    factors[2500] = 5;
+    factors[3999] = tunum::int128_t{1} << 100;
+    const auto expected_product = tunum::int128_t{-15} << 100;
+    EXPECT_EQ(tunum::reduce_product(std::span{factors}), expected_product);
+    EXPECT_EQ(tunum::reduce_product(tunum::execution::par, std::span{factors}), expected_product);
+
+    // 内積(要素同士の積が要素の型で桁あふれする場合)
+    std::vector<tunum::int128_t> lhs(3000), rhs(3000);
+    auto expected_dot = tunum::fmpint<64, true>{};
+    for (std::size_t i = 0; i < lhs.size(); i++) {
+        lhs[i] = (tunum::int128_t{static_cast<std::int64_t>(i)} << 64) * (i % 2 ? -1 : 1);
+        rhs[i] = tunum::int128_t{static_cast<std::int64_t>(i)} << 60;
+        expected_dot += tunum::fmpint<64, true>{lhs[i]} * tunum::fmpint<64, true>{rhs[i]};
+    }
+    EXPECT_EQ(tunum::dot(std::span{lhs}, std::span{rhs}), expected_dot);
+    EXPECT_EQ(tunum::dot(tunum::execution::par, std::span{lhs}, std::span{rhs}), expected_dot);
+    EXPECT_THROW(tunum::dot(std::span{lhs}, std::span{rhs}.first(2)), std::invalid_argument);
+
+    // 積が要素の型の2倍の大きさを使い切る場合、蓄積型が積より小さい場合
+    using int512_t = tunum::fmpint<64, true>;
+    const auto min128 = std::numeric_limits<tunum::int128_t>::min();
+    const auto max128 = std::numeric_limits<tunum::int128_t>::max();
+    std::vector<tunum::int128_t> extremes_l = {min128, min128, max128, max128};
+    std::vector<tunum::int128_t> extremes_r = {min128, max128, max128, min128};
+    auto expected_extremes = int512_t{};
+    for (std::size_t i = 0; i < extremes_l.size(); i++)
+        expected_extremes += int512_t{extremes_l[i]} * int512_t{extremes_r[i]};
+    EXPECT_EQ(tunum::dot(std::span{extremes_l}, std::span{extremes_r}), expected_extremes);
+    EXPECT_EQ(tunum::dot<tunum::int128_t>(std::span{extremes_l}, std::span{extremes_r}), tunum::int128_t{expected_extremes});
+    std::vector<tunum::uint128_t> umax(3, ~tunum::uint128_t{});
+    using uint512_t = tunum::fmpint<64, false>;
+    EXPECT_EQ(tunum::dot(std::span{umax}, std::span{umax}), uint512_t{~tunum::uint128_t{}} * ~tunum::uint128_t{} * 3u);
+}
+
+TEST(TunumFmpintTest, MulLimbsTest)
+{
+    using uint2048_t = tunum::fmpint<256, false>;
+    using int2048_t = tunum::fmpint<256, true>;
+    using limbs_t = std::array<std::uint32_t, uint2048_t::data_length>;
+    using tunum::_fmpint_impl::mul_algorithm;
+
+    std::uint64_t seed = 98765;
+    const auto random = [&seed]() { return static_cast<std::uint32_t>((seed = seed * 6364136223846793005ull + 1442695040888963407ull) >> 32); };
+
+    // 各アルゴリズムの結果を筆算と比較(長さの異なる場合、全ビットが1の場合を含む)
+    for (const auto& [l_size, r_size] : {std::pair{30, 30}, std::pair{97, 95}, std::pair{200, 131}, std::pair{300, 100}, std::pair{1, 64}}) {
+        for (const bool is_all_ones : {false, true}) {
+            std::vector<std::uint32_t> l(l_size), r(r_size);
+            for (auto& v : l) v = is_all_ones ? ~std::uint32_t{} : random();
+            for (auto& v : r) v = is_all_ones ? ~std::uint32_t{} : random();
+            const auto expected = tunum::_fmpint_impl::mul_schoolbook(l, r);
+            for (const auto algorithm : {mul_algorithm::karatsuba, mul_algorithm::toom3, mul_algorithm::toom4, mul_algorithm::ntt})
+                EXPECT_TRUE(tunum::_fmpint_impl::mul_limbs_with(algorithm, l, r) == expected);
+            EXPECT_TRUE(tunum::_fmpint_impl::mul_limbs(l, r) == expected);
+        }
+    }
+
+    // fmpintの乗算
+    for (int n = 0; n < 3; n++) {
+        limbs_t l{}, r{};
+        for (auto& v : l) v = random();
+        for (auto& v : r) v = random();
+        const auto product = tunum::_fmpint_impl::mul_schoolbook(l, r);
+        std::array<std::uint32_t, uint2048_t::data_length * 2> product_arr{};
+        std::copy(product.begin(), product.end(), product_arr.begin());
+        const auto expected = std::bit_cast<tunum::fmpint<512, false>>(product_arr);
+        const auto op_l = std::bit_cast<uint2048_t>(l), op_r = std::bit_cast<uint2048_t>(r);
+        EXPECT_EQ((tunum::_fmpint_impl::arithmetic<256, false>{op_l, op_r}.mul()), expected);
+        EXPECT_EQ((tunum::_fmpint_impl::arithmetic<256, false>{op_l, op_r}.mul_karatsuba()), expected);
+        // 演算子経由(下位の桁のみ)
+        EXPECT_EQ(op_l * op_r, uint2048_t{expected});
+        // 符号あり(下位の桁のみ)
+        EXPECT_EQ(int2048_t{op_l} * -int2048_t{op_r}, -int2048_t{uint2048_t{expected}});
+    }
+
+    // 定数式
+    using uint1024_t = tunum::fmpint<128, false>;
+    constexpr auto constexpr_result = (~uint1024_t{}) * (~uint1024_t{});
+    EXPECT_EQ(constexpr_result, uint1024_t{1});
+}
+
+TEST(TunumFmpintTest, PackedFmpintTest)
+{
+    using packed_uint192_t = tunum::packed_fmpint<24>;
+    using packed_int320_t = tunum::packed_fmpint<40, true>;
+    using packed_uint96_t = tunum::packed_fmpint<12>;
+    // 2の累乗に切り上げない
+    static_assert(sizeof(packed_uint192_t) == 24);
+    static_assert(sizeof(packed_int320_t) == 40);
+    static_assert(sizeof(packed_uint96_t) == 12);
+    static_assert(sizeof(tunum::packed_fmpint<5>) == 8);
+    static_assert(sizeof(std::array<packed_uint192_t, 4>) == 96);
+
+    // 加減乗除(192bitで桁あふれする)
+    const auto v1 = tunum::fmpint<24>{"1234567890123456789012345678901234567890"};
+    const auto v2 = tunum::fmpint<24>{"98765432109876543210"};
+    const auto p1 = packed_uint192_t{v1}, p2 = packed_uint192_t{v2};
+    const auto mask = (tunum::fmpint<24>{1} << 192) - 1;
+    EXPECT_EQ((p1 + p2).to_fmpint(), (v1 + v2) & mask);
+    EXPECT_EQ((p1 - p2).to_fmpint(), (v1 - v2) & mask);
+    EXPECT_EQ((p2 - p1).to_fmpint(), (v2 - v1) & mask);
+    EXPECT_EQ((p1 * p2).to_fmpint(), (v1 * v2) & mask);
+    EXPECT_EQ((p1 / p2).to_fmpint(), v1 / v2);
+    EXPECT_EQ((p1 % p2).to_fmpint(), v1 % v2);
+    EXPECT_EQ(packed_uint192_t{~tunum::fmpint<24>{}}.to_fmpint(), mask);
+    EXPECT_TRUE(p2 < p1);
+    EXPECT_TRUE(p1 == packed_uint192_t{v1});
+    EXPECT_FALSE(!p1);
+    EXPECT_TRUE(!packed_uint192_t{});
+
+    // 符号あり(最上位の要素から符号拡張する)
+    using int320_t = tunum::fmpint<40, true>;
+    const auto s1 = packed_int320_t{-12345}, s2 = packed_int320_t{678};
+    EXPECT_TRUE(s1.is_minus());
+    EXPECT_EQ(s1.to_fmpint(), int320_t(-12345));
+    EXPECT_EQ((s1 * s2).to_fmpint(), int320_t(-12345 * 678));
+    EXPECT_EQ((s1 / s2).to_fmpint(), int320_t(-12345 / 678));
+    EXPECT_EQ((s1 + s2).to_fmpint(), int320_t(-12345 + 678));
+    EXPECT_EQ((-s1).to_fmpint(), int320_t(12345));
+    EXPECT_TRUE(s1 < s2);
+    EXPECT_TRUE(-s2 < s2);
+    EXPECT_TRUE(s1 < -s2);
+
+    // 定数式
+    constexpr auto constexpr_result = packed_uint96_t{~std::uint64_t{}} * packed_uint96_t{~std::uint64_t{}};
+    EXPECT_EQ(constexpr_result.to_fmpint(), (tunum::fmpint<12>{~std::uint64_t{}} * ~std::uint64_t{}) & ((tunum::fmpint<12>{1} << 96) - 1));
+}
+
+TEST(TunumFmpintTest, ScalarArithmeticTest)
+{
+    using uint4096_t = tunum::fmpint<512, false>;
+    const auto v = (uint4096_t{1} << 4000) + (uint4096_t{0x1234'5678'9abc'def0ull} << 64) + 987654321u;
+
+    // 組み込みの整数をfmpintへ拡張した場合と比較
+    for (const std::int64_t s : {std::int64_t{0}, std::int64_t{7}, std::int64_t{-10}, std::int64_t{0xFFFF'FFFF}, std::int64_t{0x1'0000'0000}, std::int64_t{-0x7FFF'FFFF'FFFF}, (std::numeric_limits<std::int64_t>::min)()}) {
+        EXPECT_EQ(v + s, v + uint4096_t{s});
+        EXPECT_EQ(s + v, v + uint4096_t{s});
+        EXPECT_EQ(v - s, v - uint4096_t{s});
+        EXPECT_EQ(v * s, v * uint4096_t{s});
+        EXPECT_EQ(s * v, v * uint4096_t{s});
+        if (s > 0) {
+            EXPECT_EQ(v / s, v / uint4096_t{s});
+            EXPECT_EQ(v % s, v % uint4096_t{s});
+        }
+    }
+    EXPECT_EQ(v / 10u, v / uint4096_t{10});
+    EXPECT_EQ(v % 10u, uint4096_t{(v - (v / 10u) * 10u)});
+    EXPECT_THROW(v / 0, std::invalid_argument);
+    // 桁上り、桁借りの伝搬
+    EXPECT_EQ(~uint4096_t{} + 1, 0);
+    EXPECT_EQ(uint4096_t{} - 1u, ~uint4096_t{});
+    EXPECT_EQ((uint4096_t{1} << 4095) * 2, 0);
+
+    // 符号あり(0方向への丸め、余りは被除数の符号)
+    for (const int l : {100, -100, 7, -7}) {
+        for (const int r : {3, -3, 7, -7, 1}) {
+            EXPECT_EQ(tunum::int512_t{l} / r, l / r);
+            EXPECT_EQ(tunum::int512_t{l} % r, l % r);
+            EXPECT_EQ(tunum::int512_t{l} * r, l * r);
+            EXPECT_EQ(tunum::int512_t{l} + r, l + r);
+            EXPECT_EQ(tunum::int512_t{l} - r, l - r);
+        }
+    }
+    const auto signed_min = tunum::int512_t{1} << 511;
+    EXPECT_EQ(signed_min / 2, -(tunum::int512_t{1} << 510));
+
+    // 10進数文字列からの生成
+    constexpr auto parsed = tunum::uint256_t{"115792089237316195423570985008687907853269984665640564039457584007913129639935"};
+    EXPECT_EQ(parsed, ~tunum::uint256_t{});
+}
+
+TEST(TunumFmpintTest, NormalizedFmpintTest)
+{
+    using uint4096_t = tunum::fmpint<512, false>;
+    using normalized_uint4096_t = tunum::normalized_fmpint<512>;
+
+    std::uint64_t seed = 2468;
+    const auto random = [&seed]() { return seed = seed * 6364136223846793005ull + 1442695040888963407ull; };
+    // 指定ビット数程度の乱数
+    const auto random_value = [&](std::size_t bits) {
+        auto v = uint4096_t{};
+        for (std::size_t i = 0; i < bits; i += 64)
+            v = (v << 64) + random();
+        return v >> ((64 - bits % 64) % 64);
+    };
+
+    EXPECT_EQ(normalized_uint4096_t{}.active_length(), 0u);
+    EXPECT_EQ(normalized_uint4096_t{1}.active_length(), 1u);
+    EXPECT_EQ(normalized_uint4096_t{uint4096_t{1} << 100}.active_length(), 4u);
+
+    // fmpintの演算結果と比較(大きさの異なる値、桁あふれを含む)
+    for (const auto& [l_bits, r_bits] : {std::pair{100, 40}, std::pair{1000, 300}, std::pair{4096, 2000}, std::pair{200, 900}, std::pair{4096, 4096}, std::pair{64, 64}, std::pair{3000, 31}}) {
+        const auto l = random_value(l_bits), r = random_value(r_bits);
+        const auto nl = normalized_uint4096_t{l}, nr = normalized_uint4096_t{r};
+        EXPECT_EQ((nl + nr).to_fmpint(), l + r);
+        EXPECT_EQ((nl - nr).to_fmpint(), l - r);
+        EXPECT_EQ((nl * nr).to_fmpint(), l * r);
+        EXPECT_EQ((nl / nr).to_fmpint(), l / r);
+        EXPECT_EQ((nl % nr).to_fmpint(), l % r);
+        EXPECT_EQ(nl <=> nr, l <=> r);
+        EXPECT_EQ(nl == nr, l == r);
+        for (const std::size_t s : {0, 1, 31, 32, 33, 100, 4000, 4096}) {
+            EXPECT_EQ((nl << s).to_fmpint(), l << s);
+            EXPECT_EQ((nl >> s).to_fmpint(), l >> s);
+        }
+    }
+    EXPECT_EQ((normalized_uint4096_t{} - normalized_uint4096_t{1}).active_length(), normalized_uint4096_t::data_length);
+    EXPECT_EQ((normalized_uint4096_t{~uint4096_t{}} + normalized_uint4096_t{1}).active_length(), 0u);
+    EXPECT_THROW(normalized_uint4096_t{1} / normalized_uint4096_t{}, std::invalid_argument);
+
+    // 定数式
+    constexpr auto constexpr_result = (normalized_uint4096_t{1} << 2000) / normalized_uint4096_t{uint4096_t{1} << 1000};
+    EXPECT_EQ(constexpr_result.to_fmpint(), uint4096_t{1} << 1000);
+}
+
+TEST(TunumFmpintTest, InPlaceArithmeticTest)
+{
+    using uint4096_t = tunum::fmpint<512, false>;
+    // 全要素への桁上り、桁借りの伝搬
+    auto v = ~uint4096_t{};
+    v += uint4096_t{1};
+    EXPECT_EQ(v, 0);
+    v -= uint4096_t{1};
+    EXPECT_EQ(v, ~uint4096_t{});
+    v -= ~uint4096_t{};
+    EXPECT_EQ(v, 0);
+
+    // 要素の境界をまたぐ桁上り
+    auto w = (uint4096_t{1} << 2048) - 1u;
+    w += w;
+    EXPECT_EQ(w, (uint4096_t{1} << 2049) - 2u);
+    w -= (uint4096_t{1} << 2048);
+    EXPECT_EQ(w, (uint4096_t{1} << 2048) - 2u);
+
+    // 自身との演算
+    auto x = uint4096_t{12345} << 3000;
+    x += x;
+    EXPECT_EQ(x, uint4096_t{24690} << 3000);
+    x -= x;
+    EXPECT_EQ(x, 0);
+
+    // 符号あり、異なる型
+    auto y = tunum::int256_t{-5};
+    y += tunum::int256_t{3};
+    EXPECT_EQ(y, -2);
+    y -= tunum::int128_t{-10};
+    EXPECT_EQ(y, 8);
+    y -= tunum::uint128_t{20};
+    EXPECT_EQ(y, -12);
+
+    // 定数式
+    constexpr auto z = []() {
+        auto v = tunum::uint512_t{~std::uint64_t{}};
+        v += tunum::uint512_t{1};
+        v -= tunum::uint512_t{2};
+        return v;
+    }();
+    EXPECT_EQ(z, tunum::uint512_t{~std::uint64_t{}} - 1u);
+}
+
+TEST(TunumFmpintTest, ExpressionTest)
+{
+    using uint4096_t = tunum::fmpint<512, false>;
+    using tunum::lazy;
+    const auto a = (uint4096_t{0x1234'5678'9abc'def0ull} << 2000) + 0xFFFF'FFFFu;
+    const auto b = (uint4096_t{0xfedc'ba98'7654'3210ull} << 2090) + 7u;
+    const auto c = ~uint4096_t{} - 3u;
+    const auto d = uint4096_t{1} << 4095;
+
+    // 複数オペランドの和
+    EXPECT_EQ(uint4096_t{lazy(a) + b}, a + b);
+    EXPECT_EQ(uint4096_t{lazy(a) + b + c + d}, a + b + c + d);
+    EXPECT_EQ((lazy(c) + c + c + c + c).eval(), c * 5u);
+
+    // 積和(桁あふれを含む)
+    auto acc = c;
+    acc += lazy(a) * b;
+    EXPECT_EQ(acc, c + a * b);
+    auto acc2 = uint4096_t{5};
+    acc2 += lazy(c) * c;
+    EXPECT_EQ(acc2, uint4096_t{5} + c * c);
+    EXPECT_EQ((lazy(a) * b).eval(), a * b);
+
+    // 積の剰余(積がfmpintの範囲を超える場合)
+    using uint8192_t = tunum::fmpint<1024, false>;
+    for (const auto& m : {b, c, uint4096_t{1000000007u}, uint4096_t{~std::uint64_t{}}, a * b + 1u}) {
+        const auto expected = uint4096_t{uint8192_t{a} * uint8192_t{c} % uint8192_t{m}};
+        EXPECT_EQ(uint4096_t{(lazy(a) * c) % m}, expected);
+    }
+    EXPECT_EQ(uint4096_t{(lazy(uint4096_t{3}) * uint4096_t{4}) % uint4096_t{100}}, 12);
+    EXPECT_THROW(uint4096_t{(lazy(a) * b) % uint4096_t{}}, std::invalid_argument);
+
+    // 符号あり(桁あふれした部分は破棄)
+    const auto s1 = tunum::int256_t{-7}, s2 = tunum::int256_t{3};
+    auto s_acc = tunum::int256_t{10};
+    s_acc += lazy(s1) * s2;
+    EXPECT_EQ(s_acc, -11);
+    EXPECT_EQ(tunum::int256_t{lazy(s1) + s2 + s2}, -1);
+
+    // 定数式
+    constexpr auto constexpr_result = []() {
+        const auto x = tunum::uint256_t{~std::uint64_t{}}, y = tunum::uint256_t{3}, m = tunum::uint256_t{1000};
+        auto acc = tunum::uint256_t{lazy(x) + y + y};
+        acc += lazy(x) * y;
+        return tunum::uint256_t{(lazy(acc) * y) % m};
+    }();
+    EXPECT_EQ(constexpr_result, ((tunum::uint256_t{~std::uint64_t{}} + 6u + tunum::uint256_t{~std::uint64_t{}} * 3u) * 3u) % 1000u);
+}
+
+TEST(TunumFmpintTest, OverflowTest)
+{
+    using tunum::uint256_t;
+    using tunum::int256_t;
+    constexpr auto umax = std::numeric_limits<uint256_t>::max();
+    constexpr auto imax = std::numeric_limits<int256_t>::max();
+    constexpr auto imin = std::numeric_limits<int256_t>::min();
+
+    // 符号なし
+    {
+        const auto [v, overflow] = tunum::add_overflow(umax, uint256_t{1});
+        EXPECT_EQ(v, 0);
+        EXPECT_TRUE(overflow);
+    }
+    EXPECT_FALSE(tunum::add_overflow(umax - 1u, uint256_t{1}).overflow);
+    {
+        const auto [v, overflow] = tunum::sub_overflow(uint256_t{1}, uint256_t{2});
+        EXPECT_EQ(v, umax);
+        EXPECT_TRUE(overflow);
+    }
+    {
+        const auto [v, overflow] = tunum::mul_overflow(uint256_t{1} << 200, uint256_t{3} << 55);
+        EXPECT_EQ(v, uint256_t{1} << 255);
+        EXPECT_TRUE(overflow);
+    }
+    EXPECT_FALSE(tunum::mul_overflow(uint256_t{1} << 200, uint256_t{3} << 54).overflow);
+
+    // 符号あり
+    EXPECT_TRUE(tunum::add_overflow(imax, int256_t{1}).overflow);
+    EXPECT_EQ(tunum::add_overflow(imax, int256_t{1}).value, imin);
+    EXPECT_FALSE(tunum::add_overflow(imax, int256_t{-1}).overflow);
+    EXPECT_TRUE(tunum::add_overflow(imin, int256_t{-1}).overflow);
+    EXPECT_TRUE(tunum::sub_overflow(imin, int256_t{1}).overflow);
+    EXPECT_FALSE(tunum::sub_overflow(int256_t{-1}, imax).overflow);
+    EXPECT_TRUE(tunum::sub_overflow(int256_t{0}, imin).overflow);
+    EXPECT_FALSE(tunum::mul_overflow(int256_t{1} << 254, int256_t{-2}).overflow);
+    EXPECT_EQ(tunum::mul_overflow(int256_t{1} << 254, int256_t{-2}).value, imin);
+    EXPECT_TRUE(tunum::mul_overflow(int256_t{1} << 254, int256_t{2}).overflow);
+    EXPECT_TRUE(tunum::mul_overflow(imin, int256_t{-1}).overflow);
+    EXPECT_EQ(tunum::mul_overflow(int256_t{-12345}, int256_t{6789}).value, -12345 * 6789);
+    EXPECT_FALSE(tunum::mul_overflow(int256_t{-12345}, int256_t{6789}).overflow);
+
+    // 飽和演算
+    using sat_u = tunum::saturating<uint256_t>;
+    using sat_i = tunum::saturating<int256_t>;
+    EXPECT_EQ((sat_u{umax} + sat_u{5}).value, umax);
+    EXPECT_EQ((sat_u{3} - sat_u{5}).value, 0);
+    EXPECT_EQ((sat_u{umax} * sat_u{2}).value, umax);
+    EXPECT_EQ((sat_u{7} * sat_u{6}).value, 42);
+    EXPECT_EQ((sat_i{imax} + sat_i{1}).value, imax);
+    EXPECT_EQ((sat_i{imin} + sat_i{-1}).value, imin);
+    EXPECT_EQ((sat_i{imin} - sat_i{1}).value, imin);
+    EXPECT_EQ((sat_i{imax} - sat_i{-1}).value, imax);
+    EXPECT_EQ((sat_i{imax} * sat_i{-3}).value, imin);
+    EXPECT_EQ((sat_i{imin} / sat_i{-1}).value, imax);
+    EXPECT_EQ((sat_i{-20} / sat_i{3}).value, -6);
+
+    // 検査付き演算
+    using chk_u = tunum::checked<uint256_t>;
+    using chk_i = tunum::checked<int256_t>;
+    EXPECT_THROW(chk_u{umax} + chk_u{1}, std::overflow_error);
+    EXPECT_THROW(chk_u{0} - chk_u{1}, std::overflow_error);
+    EXPECT_THROW(chk_u{umax} * chk_u{2}, std::overflow_error);
+    EXPECT_THROW(chk_i{imin} / chk_i{-1}, std::overflow_error);
+    EXPECT_EQ((chk_i{-20} * chk_i{3} + chk_i{5}).value, -55);
+
+    // 定数式
+    constexpr auto c = tunum::add_overflow(umax, uint256_t{2});
+    static_assert(c.overflow && c.value == 1);
+    constexpr auto s = sat_u{umax} + sat_u{1};
+    static_assert(s.value == umax);
+}
+
+TEST(TunumFmpintTest, BytesTest)
+{
+    using tunum::uint256_t;
+    using tunum::int128_t;
+    static_assert(std::is_trivially_copyable_v<uint256_t> && std::is_standard_layout_v<uint256_t>);
+    static_assert(sizeof(uint256_t) == 32);
+
+    // 1要素
+    const auto v = (uint256_t{0x01020304'05060708ull} << 192) | 0x090A0B0C'0D0E0F10ull;
+    std::array<std::byte, 32> buf{};
+    tunum::store_le(v, buf);
+    EXPECT_EQ(buf[0], std::byte{0x10});
+    EXPECT_EQ(buf[7], std::byte{0x09});
+    EXPECT_EQ(buf[8], std::byte{0x00});
+    EXPECT_EQ(buf[31], std::byte{0x01});
+    EXPECT_EQ(tunum::load_le<uint256_t>(buf), v);
+    tunum::store_be(v, buf);
+    EXPECT_EQ(buf[0], std::byte{0x01});
+    EXPECT_EQ(buf[7], std::byte{0x08});
+    EXPECT_EQ(buf[31], std::byte{0x10});
+    EXPECT_EQ(tunum::load_be<uint256_t>(buf), v);
+
+    // 符号あり
+    std::array<std::byte, 16> buf16{};
+    tunum::store_be(int128_t{-2}, buf16);
+    EXPECT_EQ(buf16[0], std::byte{0xFF});
+    EXPECT_EQ(buf16[15], std::byte{0xFE});
+    EXPECT_EQ(tunum::load_be<int128_t>(buf16), -2);
+
+    // バイト列が足りない場合
+    EXPECT_THROW(tunum::load_le<uint256_t>(std::span{buf}.first(31)), std::out_of_range);
+    EXPECT_THROW(tunum::store_be(v, std::span{buf}.first(31)), std::out_of_range);
+
+    // 一括変換
+    std::vector<uint256_t> values;
+    for (std::uint32_t i = 0; i < 100; i++)
+        values.push_back((uint256_t{i} << 200) + i * 0x01010101u);
+    std::vector<std::byte> bytes(values.size() * sizeof(uint256_t));
+    std::vector<uint256_t> loaded(values.size());
+    tunum::store_le(std::span{std::as_const(values)}, bytes);
+    EXPECT_EQ(tunum::load_le<uint256_t>(std::span{bytes}.subspan(32 * 5)), values[5]);
+    tunum::load_le(std::span<const std::byte>{bytes}, std::span{loaded});
+    EXPECT_EQ(loaded, values);
+    tunum::store_be(std::span{values}, bytes);
+    EXPECT_EQ(tunum::load_be<uint256_t>(std::span{bytes}.subspan(32 * 7)), values[7]);
+    std::fill(loaded.begin(), loaded.end(), uint256_t{});
+    tunum::load_be(std::span<const std::byte>{bytes}, std::span{loaded});
+    EXPECT_EQ(loaded, values);
+    EXPECT_THROW(tunum::load_be(std::span<const std::byte>{bytes}.first(99), std::span{loaded}), std::out_of_range);
+    // バイト数が足りない場合は何も書き込まない
+    std::fill(bytes.begin(), bytes.end(), std::byte{0xEE});
+    EXPECT_THROW(tunum::store_be(std::span{values}, std::span{bytes}.first(bytes.size() - 1)), std::out_of_range);
+    EXPECT_TRUE(std::all_of(bytes.begin(), bytes.end(), [](std::byte b) { return b == std::byte{0xEE}; }));
+
+    // 定数式
+    constexpr auto round_trip = []() {
+        std::array<std::byte, 32> b{};
+        tunum::store_be(uint256_t{0xABCDu} << 100, b);
+        return tunum::load_be<uint256_t>(b);
+    }();
+    static_assert(round_trip == (uint256_t{0xABCDu} << 100));
+    constexpr auto bulk_round_trip = []() {
+        const std::array<uint256_t, 2> in{uint256_t{0x1234u} << 200, uint256_t{0x5678u} << 8};
+        std::array<std::byte, 64> b{};
+        std::array<uint256_t, 2> out{};
+        tunum::store_be(std::span<const uint256_t>{in}, b);
+        tunum::load_be(std::span<const std::byte>{b}, std::span<uint256_t>{out});
+        return out == in && b[5] == std::byte{0x12} && b[6] == std::byte{0x34} && b[63] == std::byte{0x00} && b[62] == std::byte{0x78};
+    }();
+    static_assert(bulk_round_trip);
+}
+
+TEST(TunumFmpintTest, MappedArrayTest)
+{
+    using tunum::uint256_t;
+    const auto path = std::filesystem::temp_directory_path() / "tunum_mapped_array_test.bin";
+
+    // バッファの境界をまたいで書き込む
+    std::vector<uint256_t> values;
+    for (std::uint32_t i = 0; i < 1000; i++)
+        values.push_back((uint256_t{i} << 128) * 0x9E3779B9u + i);
+    {
+        tunum::fmpint_array_writer<32> writer{path, 64};
+        for (std::size_t i = 0; i < 100; i++)
+            writer.push(values[i]);
+        writer.write(std::span{values}.subspan(100, 10));
+        writer.write(std::span{values}.subspan(110));
+        EXPECT_EQ(writer.size(), values.size());
+    }
+    EXPECT_EQ(std::filesystem::file_size(path), 32 + values.size() * sizeof(uint256_t));
+
+    {
+        tunum::mapped_fmpint_array<32> mapped{path};
+        ASSERT_EQ(mapped.size(), values.size());
+        EXPECT_TRUE(std::equal(mapped.begin(), mapped.end(), values.begin()));
+        std::span<const uint256_t> view = mapped;
+        EXPECT_EQ(view[123], values[123]);
+        EXPECT_EQ(mapped.at(999), values[999]);
+        EXPECT_THROW(static_cast<void>(mapped.at(1000)), std::out_of_range);
+
+        auto moved = std::move(mapped);
+        EXPECT_EQ(moved[5], values[5]);
+    }
+
+    // 型が異なる場合、ファイルでない場合
+    EXPECT_THROW((tunum::mapped_fmpint_array<32, true>{path}), std::runtime_error);
+    EXPECT_THROW(tunum::mapped_fmpint_array<64>{path}, std::runtime_error);
+    EXPECT_THROW(tunum::mapped_fmpint_array<32>{path.string() + ".missing"}, std::runtime_error);
+
+    // ムーブ代入で置き換えられたファイルも、書き込んだ要素を保持する
+    const auto path2 = std::filesystem::temp_directory_path() / "tunum_mapped_array_test2.bin";
+    {
+        tunum::fmpint_array_writer<32> writer{path};
+        writer.push(values[0]);
+        writer.push(values[1]);
+        writer = tunum::fmpint_array_writer<32>{path2};
+        writer.push(values[2]);
+    }
+    {
+        const tunum::mapped_fmpint_array<32> replaced{path};
+        ASSERT_EQ(replaced.size(), 2u);
+        EXPECT_EQ(replaced[1], values[1]);
+        const tunum::mapped_fmpint_array<32> assigned{path2};
+        ASSERT_EQ(assigned.size(), 1u);
+        EXPECT_EQ(assigned[0], values[2]);
+    }
+    std::filesystem::remove(path2);
+
+    // 空の配列
+    {
+        tunum::fmpint_array_writer<16, true> writer{path};
+        writer.close();
+    }
+    const tunum::mapped_fmpint_array<16, true> empty{path};
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.begin(), empty.end());
+    std::filesystem::remove(path);
+}
+
+TEST(TunumFmpintTest, VarintTest)
+{
+    using tunum::uint256_t;
+    using tunum::int256_t;
+    using uint2048_t = tunum::fmpint<256, false>;
+    std::array<std::byte, 64> buf{};
+
+    // 先頭の1バイトが値のバイト数
+    EXPECT_EQ(tunum::varint_encode(uint256_t{0}, buf), 1u);
+    EXPECT_EQ(buf[0], std::byte{0});
+    EXPECT_EQ(tunum::varint_encode(uint256_t{0x1234}, buf), 3u);
+    EXPECT_EQ(buf[0], std::byte{2});
+    EXPECT_EQ(buf[1], std::byte{0x34});
+    EXPECT_EQ(buf[2], std::byte{0x12});
+    EXPECT_EQ(tunum::varint_size(~uint256_t{}), 33u);
+    EXPECT_EQ(tunum::varint_max_size_v<uint256_t>, 33u);
+
+    // ジグザグ符号化
+    EXPECT_EQ(tunum::varint_size(int256_t{-1}), 2u);
+    EXPECT_EQ(tunum::varint_size(int256_t{-128}), 2u);
+    EXPECT_EQ(tunum::varint_size(int256_t{-129}), 3u);
+    EXPECT_EQ(tunum::varint_size(std::numeric_limits<int256_t>::min()), 33u);
+    for (const auto v : {int256_t{0}, int256_t{-1}, int256_t{1}, int256_t{-300}, std::numeric_limits<int256_t>::min(), std::numeric_limits<int256_t>::max()}) {
+        auto decoded = int256_t{42};
+        const auto size = tunum::varint_encode(v, buf);
+        EXPECT_EQ(tunum::varint_decode(std::span{buf}.first(size), decoded), size);
+        EXPECT_EQ(decoded, v);
+    }
+
+    // 値のバイト数が128以上の場合は、バイト数を2バイトで符号化
+    const auto large = ~uint2048_t{} >> 8;
+    std::vector<std::byte> large_buf(tunum::varint_max_size_v<uint2048_t>);
+    EXPECT_EQ(tunum::varint_encode(large, large_buf), 2u + 255u);
+    auto large_decoded = uint2048_t{};
+    EXPECT_EQ(tunum::varint_decode(large_buf, large_decoded), 257u);
+    EXPECT_EQ(large_decoded, large);
+
+    // 不正な入力
+    auto v = uint256_t{};
+    EXPECT_THROW(tunum::varint_encode(~uint256_t{}, std::span{buf}.first(32)), std::out_of_range);
+    buf[0] = std::byte{33};
+    EXPECT_THROW(tunum::varint_decode(buf, v), std::invalid_argument);
+    buf[0] = std::byte{4};
+    EXPECT_THROW(tunum::varint_decode(std::span{buf}.first(4), v), std::out_of_range);
+    EXPECT_THROW(tunum::varint_decode(std::span<const std::byte>{}, v), std::out_of_range);
+
+    // 一括変換
+    std::vector<uint256_t> values;
+    for (std::uint32_t i = 0; i < 500; i++)
+        values.push_back(uint256_t{i * i} << (i % 200));
+    std::vector<std::byte> bytes(values.size() * tunum::varint_max_size_v<uint256_t>);
+    const auto written = tunum::varint_encode(std::span{values}, bytes);
+    EXPECT_LT(written, values.size() * sizeof(uint256_t));
+    std::vector<uint256_t> decoded(values.size());
+    EXPECT_EQ(tunum::varint_decode(std::span{bytes}.first(written), std::span{decoded}), written);
+    EXPECT_EQ(decoded, values);
+
+    // 定数式
+    constexpr auto round_trip = []() {
+        std::array<std::byte, 33> b{};
+        tunum::varint_encode(int256_t{-123456789}, b);
+        auto v = int256_t{};
+        tunum::varint_decode(b, v);
+        return v;
+    }();
+    static_assert(round_trip == -123456789);
+}
+
+TEST(TunumFmpintTest, ParseColumnTest)
+{
+    using tunum::uint256_t;
+    using tunum::int128_t;
+    using namespace std::string_view_literals;
+
+    // 10進数、16進数、2進数の混在
+    std::vector<uint256_t> out(8);
+    const auto text = "0\n12345678\n123456789012345678901234567890,0xDeadBeef0123456789\r\n 0b1011 \n007\n"sv;
+    const auto result = tunum::parse_column(text, std::span{out});
+    EXPECT_EQ(result.rows, 6u);
+    EXPECT_EQ(result.consumed, text.size());
+    EXPECT_TRUE(result.errors.empty());
+    EXPECT_EQ(out[0], 0);
+    EXPECT_EQ(out[1], 12345678);
+    EXPECT_EQ(out[2], uint256_t{"123456789012345678901234567890"});
+    EXPECT_EQ(out[3], uint256_t{"0xDEADBEEF0123456789"});
+    EXPECT_EQ(out[4], 11);
+    EXPECT_EQ(out[5], 7);
+
+    // 最大値、桁あふれ、不正な文字
+    const auto max_str = "115792089237316195423570985008687907853269984665640564039457584007913129639935"sv;
+    const auto text2 = std::string{max_str} + "\n115792089237316195423570985008687907853269984665640564039457584007913129639936\n"
+        + "0x1" + std::string(64, '0') + "\n12:4\n\n-1\n0x\n12345678901234567a\n0x" + std::string(64, 'f');
+    out.resize(10);
+    const auto result2 = tunum::parse_column(std::string_view{text2}, std::span{out});
+    EXPECT_EQ(result2.rows, 9u);
+    EXPECT_EQ(out[0], std::numeric_limits<uint256_t>::max());
+    EXPECT_EQ(out[8], std::numeric_limits<uint256_t>::max());
+    EXPECT_EQ(out[1], 0);
+    const auto expected_errors = std::vector<tunum::parse_error>{
+        {1, std::errc::result_out_of_range},
+        {2, std::errc::result_out_of_range},
+        {3, std::errc::invalid_argument},
+        {4, std::errc::invalid_argument},
+        {5, std::errc::invalid_argument},
+        {6, std::errc::invalid_argument},
+        {7, std::errc::invalid_argument},
+    };
+    EXPECT_EQ(result2.errors, expected_errors);
+
+    // 符号あり
+    std::vector<int128_t> signed_out(4);
+    const auto result3 = tunum::parse_column("-170141183460469231731687303715884105728,170141183460469231731687303715884105728,-0x10,+42"sv, std::span{signed_out});
+    EXPECT_EQ(signed_out[0], std::numeric_limits<int128_t>::min());
+    EXPECT_EQ(signed_out[2], -16);
+    EXPECT_EQ(signed_out[3], 42);
+    ASSERT_EQ(result3.errors.size(), 1u);
+    EXPECT_EQ(result3.errors[0], (tunum::parse_error{1, std::errc::result_out_of_range}));
+
+    // 分割した入力
+    const auto stream = "111,222,333\n444,5"sv;
+    std::vector<uint256_t> chunked(5);
+    const auto first = tunum::parse_column(stream.substr(0, 9), std::span{chunked}, false);
+    EXPECT_EQ(first.rows, 2u);
+    EXPECT_EQ(first.consumed, 8u);
+    const auto rest = tunum::parse_column(stream.substr(first.consumed), std::span{chunked}.subspan(first.rows));
+    EXPECT_EQ(rest.rows, 3u);
+    EXPECT_EQ(chunked, (std::vector<uint256_t>{111, 222, 333, 444, 5}));
+
+    // 出力先が埋まった場合
+    std::vector<uint256_t> small(2);
+    const auto partial = tunum::parse_column("1,2,3,4"sv, std::span{small});
+    EXPECT_EQ(partial.rows, 2u);
+    EXPECT_EQ(partial.consumed, 4u);
+
+    // ワイド文字
+    std::vector<uint256_t> wide(2);
+    EXPECT_TRUE(tunum::parse_column(L"123456789012\n0xff"sv, std::span{wide}).errors.empty());
+    EXPECT_EQ(wide[0], 123456789012ull);
+    EXPECT_EQ(wide[1], 255);
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 #include <tunum/math.hpp>
+#include <array>
+#include <vector>
+#include <span>
 
 using floating_limit_t = std::numeric_limits<float>;
 namespace test_values
@@ -341,3 +344,113 @@ TEST(TunumMathTest, MathTest)
     EXPECT_EQ(ln_4, std::log(float(0.09)));
     EXPECT_EQ(ln_5, std::log(float(0.17)));
 }
+
+TEST(TunumMathTest, ExpLogKernelTest)
+{
+    // 定数式と実行時の結果が一致
+    constexpr auto exp_1 = tunum::exp(1.5);
+    constexpr auto exp_2 = tunum::exp(-700.25);
+    constexpr auto exp_3 = tunum::exp(709.5);
+    constexpr auto exp_4 = tunum::exp(-740.);
+    constexpr auto ln_1 = tunum::ln(7.25);
+    constexpr auto ln_2 = tunum::ln(std::numeric_limits<double>::denorm_min());
+    constexpr auto log2_1 = tunum::log2(3.);
+    constexpr auto log2_2 = tunum::log2(1024.f);
+    volatile auto v_exp_1 = 1.5, v_exp_2 = -700.25, v_exp_3 = 709.5, v_exp_4 = -740.;
+    volatile auto v_ln_1 = 7.25, v_ln_2 = std::numeric_limits<double>::denorm_min(), v_log2_1 = 3.;
+    volatile auto v_log2_2 = 1024.f;
+    EXPECT_EQ(exp_1, tunum::exp(double(v_exp_1)));
+    EXPECT_EQ(exp_2, tunum::exp(double(v_exp_2)));
+    EXPECT_EQ(exp_3, tunum::exp(double(v_exp_3)));
+    EXPECT_EQ(exp_4, tunum::exp(double(v_exp_4)));
+    EXPECT_EQ(ln_1, tunum::ln(double(v_ln_1)));
+    EXPECT_EQ(ln_2, tunum::ln(double(v_ln_2)));
+    EXPECT_EQ(log2_1, tunum::log2(double(v_log2_1)));
+    EXPECT_EQ(log2_2, tunum::log2(float(v_log2_2)));
+    EXPECT_EQ(log2_2, 10.f);
+
+    // 境界値
+    EXPECT_EQ(tunum::exp(710.), std::numeric_limits<double>::infinity());
+    EXPECT_EQ(tunum::exp(89.f), std::numeric_limits<float>::infinity());
+    EXPECT_EQ(tunum::exp(-746.), 0.);
+    EXPECT_EQ(tunum::exp(0.), 1.);
+    EXPECT_TRUE(std::isnan(tunum::exp(std::numeric_limits<double>::quiet_NaN())));
+    EXPECT_EQ(tunum::ln(std::numeric_limits<double>::infinity()), std::numeric_limits<double>::infinity());
+    EXPECT_THROW(tunum::ln(0.), std::invalid_argument);
+    EXPECT_THROW(tunum::log2(-1.f), std::invalid_argument);
+
+    // 標準ライブラリとの誤差が1ulp以内
+    const auto within_ulp = [](double actual, double expected) {
+        return std::nextafter(expected, -HUGE_VAL) <= actual && actual <= std::nextafter(expected, HUGE_VAL);
+    };
+    for (auto x = -700.; x < 700.; x += 0.37) {
+        EXPECT_TRUE(within_ulp(tunum::exp(x), std::exp(x))) << x;
+        const auto y = std::abs(x) + 0x1p-20;
+        EXPECT_TRUE(within_ulp(tunum::ln(y), std::log(y))) << y;
+        EXPECT_TRUE(within_ulp(tunum::log2(y), std::log2(y))) << y;
+    }
+
+    // 配列版は要素ごとの計算と一致
+    auto xs = std::array{-1., 0.5, 3., 100., 1e-310, 800., 42.};
+    auto exp_xs = xs;
+    tunum::exp(std::span{exp_xs});
+    for (std::size_t i = 0; i < xs.size(); i++)
+        EXPECT_EQ(exp_xs[i], tunum::exp(xs[i]));
+
+    auto ln_xs = std::vector<float>(200);
+    for (std::size_t i = 0; i < ln_xs.size(); i++)
+        ln_xs[i] = static_cast<float>(i + 1) / 8;
+    auto log2_xs = ln_xs;
+    const auto expected_xs = ln_xs;
+    tunum::ln(std::span{ln_xs});
+    tunum::log2(std::span{log2_xs});
+    for (std::size_t i = 0; i < expected_xs.size(); i++) {
+        EXPECT_EQ(ln_xs[i], tunum::ln(expected_xs[i]));
+        EXPECT_EQ(log2_xs[i], tunum::log2(expected_xs[i]));
+    }
+
+    auto invalid_xs = std::array{1., 0., 2.};
+    EXPECT_THROW(tunum::ln(std::span{invalid_xs}), std::invalid_argument);
+}
+
+TEST(TunumMathTest, RootTest)
+{
+    // 定数式でも正しく丸められる
+    constexpr auto sqrt_1 = tunum::sqrt(1e300);
+    constexpr auto sqrt_2 = tunum::sqrt(0.1);
+    constexpr auto sqrt_3 = tunum::sqrt(std::numeric_limits<double>::denorm_min());
+    constexpr auto sqrt_4 = tunum::sqrt(test_values::denorm);
+    constexpr auto sqrt_5 = tunum::sqrt(test_values::max_norm);
+    constexpr auto sqrt_6 = tunum::sqrt(0.25f);
+    EXPECT_EQ(sqrt_1, std::sqrt(1e300));
+    EXPECT_EQ(sqrt_2, std::sqrt(0.1));
+    EXPECT_EQ(sqrt_3, std::sqrt(std::numeric_limits<double>::denorm_min()));
+    EXPECT_EQ(sqrt_4, std::sqrt(test_values::denorm));
+    EXPECT_EQ(sqrt_5, std::sqrt(test_values::max_norm));
+    EXPECT_EQ(sqrt_6, 0.5f);
+    for (auto x = 1e-30; x < 1e30; x *= 1.7)
+        EXPECT_EQ(tunum::_math_impl::std_floating_sqrt_impl::run(x), std::sqrt(x)) << x;
+
+    constexpr auto rsqrt_1 = tunum::rsqrt(4.);
+    constexpr auto rsqrt_2 = tunum::rsqrt(0.f);
+    constexpr auto cbrt_1 = tunum::cbrt(-27.);
+    constexpr auto cbrt_2 = tunum::cbrt(1000.f);
+    constexpr auto cbrt_3 = tunum::cbrt(-0.);
+    EXPECT_EQ(rsqrt_1, 0.5);
+    EXPECT_EQ(rsqrt_2, test_values::inf);
+    EXPECT_EQ(cbrt_1, -3.);
+    EXPECT_EQ(cbrt_2, 10.f);
+    EXPECT_TRUE(cbrt_3 == 0 && std::signbit(cbrt_3));
+    EXPECT_THROW(tunum::rsqrt(-1.), std::invalid_argument);
+
+    // long double で求めた値との誤差1ulp以内
+    const auto within_ulp = [](double actual, long double expected) {
+        const auto rounded = static_cast<double>(expected);
+        return std::nextafter(rounded, -HUGE_VAL) <= actual && actual <= std::nextafter(rounded, HUGE_VAL);
+    };
+    for (auto x = 1e-300; x < 1e300; x *= 3.3) {
+        EXPECT_TRUE(within_ulp(tunum::rsqrt(x), 1 / std::sqrt(static_cast<long double>(x)))) << x;
+        EXPECT_TRUE(within_ulp(tunum::cbrt(x), std::cbrt(static_cast<long double>(x)))) << x;
+        EXPECT_TRUE(within_ulp(tunum::cbrt(-x), std::cbrt(-static_cast<long double>(x)))) << x;
+    }
+}
@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+#include <tunum/numerical_calc.hpp>
+#include <tunum/fmpint.hpp>
+#include <cmath>
+#include <array>
+#include <span>
+
+TEST(TunumNumericalCalcTest, NewtonRaphsonTest)
+{
+    constexpr auto f = [](double x) { return x * x - 2; };
+    constexpr auto df = [](double x) { return 2 * x; };
+
+    // 既定(差分0)でも、隣接する値間の振動を検出して収束する
+    constexpr auto result_1 = tunum::newton_raphson{f, df}.solve(1.);
+    EXPECT_TRUE(result_1.converged);
+    EXPECT_NEAR(result_1.value, std::sqrt(2.), 1e-15);
+    EXPECT_LT(result_1.iterations, 10u);
+
+    constexpr auto result_2 = tunum::newton_raphson{f, df}.solve(1., tunum::residual_tolerance{1e-6});
+    EXPECT_TRUE(result_2.converged);
+    EXPECT_LT(result_2.iterations, result_1.iterations);
+
+    // 2周期で振動する場合は、反復回数の上限なしでも終了し、収束しない
+    constexpr auto result_3 = tunum::newton_raphson{
+            [](double x) { return x * x * x - 2 * x + 2; },
+            [](double x) { return 3 * x * x - 2; }
+        }
+        .solve(0.);
+    EXPECT_FALSE(result_3.converged);
+
+    // 反復回数の上限
+    constexpr auto result_4 = tunum::newton_raphson{f, df}.solve(1e10, tunum::step_tolerance<double>{}, 10);
+    EXPECT_FALSE(result_4.converged);
+    EXPECT_EQ(result_4.iterations, 10u);
+
+    // 導関数がゼロ
+    constexpr auto result_5 = tunum::newton_raphson{f, df}.solve(0.);
+    EXPECT_FALSE(result_5.converged);
+    EXPECT_EQ(result_5.iterations, 0u);
+
+    constexpr auto resolve_1 = tunum::newton_raphson{f, df}.resolve(1.);
+    EXPECT_EQ(resolve_1, result_1.value);
+}
+
+TEST(TunumNumericalCalcTest, DualTest)
+{
+    // f(x) = (x^2 + 1) / (x - 3) の x = 2 における値と微分係数
+    constexpr auto x = tunum::dual<double>::variable(2.);
+    constexpr auto y = (x * x + 1) / (x - 3);
+    EXPECT_EQ(y.value, -5.);
+    EXPECT_EQ(y.derivative, (2. * 2. * (2. - 3.) - (2. * 2. + 1.)) / ((2. - 3.) * (2. - 3.)));
+    EXPECT_EQ((-x).derivative, -1.);
+    // 比較は値のみ
+    EXPECT_TRUE(x == tunum::dual{2.});
+    EXPECT_TRUE(x < 3);
+    static_assert(tunum::TuArithmetic<tunum::dual<double>>);
+
+    // 導関数の省略
+    constexpr auto f = [](const auto& x) { return x * x - 2; };
+    constexpr auto result_1 = tunum::newton_raphson{f}.solve(1.);
+    constexpr auto result_2 = tunum::newton_raphson{f, [](double x) { return 2 * x; }}.solve(1.);
+    EXPECT_TRUE(result_1.converged);
+    EXPECT_EQ(result_1.value, result_2.value);
+    EXPECT_EQ(result_1.iterations, result_2.iterations);
+
+    // fmpint
+    using int128_t = tunum::fmpint<16, true>;
+    const auto result_3 = tunum::newton_raphson{[](const auto& x) { return x * x * x - 27; }}.solve(int128_t{100});
+    EXPECT_TRUE(result_3.converged);
+    EXPECT_TRUE(result_3.value - 3 <= 1);
+}
+
+TEST(TunumNumericalCalcTest, NewtonRaphsonBatchTest)
+{
+    constexpr auto solver = tunum::newton_raphson_batch{
+        [](double x, double p) { return x * x - p; },
+        [](double x, double) { return 2 * x; }
+    };
+
+    // レーン数の端数を含む
+    constexpr std::size_t size = decltype(solver)::lane_width * 2 + 3;
+    std::array<double, size> params = {};
+    std::array<double, size> values = {};
+    std::array<bool, size> converged = {};
+    for (std::size_t i = 0; i < size; i++) {
+        params[i] = static_cast<double>(i + 1);
+        values[i] = 1.;
+    }
+    // 導関数がゼロとなる初期値は収束しない
+    values[5] = 0.;
+    // 導関数がゼロでも、関数値がゼロであれば収束する
+    params[6] = 0.;
+    values[6] = 0.;
+    const auto inits = values;
+
+    const auto result_1 = solver.solve<double>(params, values, converged);
+    EXPECT_EQ(result_1.converged_count, size - 1);
+    for (std::size_t i = 0; i < size; i++) {
+        if (i == 5) {
+            EXPECT_FALSE(converged[i]);
+            EXPECT_EQ(values[i], 0.);
+            continue;
+        }
+        EXPECT_TRUE(converged[i]);
+        // 単一の方程式を解いた場合と一致する
+        const auto p = params[i];
+        const auto scalar_result = tunum::newton_raphson{
+                [p](double x) { return x * x - p; },
+                [](double x) { return 2 * x; }
+            }
+            .solve(inits[i]);
+        EXPECT_TRUE(scalar_result.converged);
+        EXPECT_EQ(values[i], scalar_result.value);
+    }
+
+    // 反復回数の上限
+    std::array<double, 3> values_2 = {1e10, 1e10, 1e10};
+    const auto result_2 = solver.solve<double>(std::span{params}.first(3), values_2, tunum::step_tolerance<double>{}, 5);
+    EXPECT_EQ(result_2.iterations, 5u);
+    EXPECT_EQ(result_2.converged_count, 0u);
+
+    EXPECT_THROW(solver.solve<double>(params, std::span{values}.first(3)), std::invalid_argument);
+
+    // 定数式
+    constexpr auto result_3 = [&solver]() {
+        std::array<double, 2> p = {4., 9.};
+        std::array<double, 2> v = {1., 1.};
+        solver.solve<double>(p, v);
+        return v;
+    }();
+    EXPECT_EQ(result_3[0], 2.);
+    EXPECT_EQ(result_3[1], 3.);
+}
+
+TEST(TunumNumericalCalcTest, HalleyTest)
+{
+    constexpr auto f = [](double x) { return x * x * x - 10; };
+    constexpr auto df = [](double x) { return 3 * x * x; };
+    constexpr auto ddf = [](double x) { return 6 * x; };
+
+    constexpr auto newton_result = tunum::newton_raphson{f, df}.solve(1., tunum::residual_tolerance{1e-12});
+    constexpr auto halley_result = tunum::halley{f, df, ddf}.solve(1., tunum::residual_tolerance{1e-12});
+    EXPECT_TRUE(halley_result.converged);
+    EXPECT_NEAR(halley_result.value, std::cbrt(10.), 1e-13);
+    // 3次収束のため、ニュートン法より反復回数が少ない
+    EXPECT_LT(halley_result.iterations, newton_result.iterations);
+}
+
+TEST(TunumNumericalCalcTest, SecantTest)
+{
+    constexpr auto result_1 = tunum::secant{[](double x) { return std::numbers::pi - x * x; }}.solve(1., 2.);
+    EXPECT_TRUE(result_1.converged);
+    EXPECT_NEAR(result_1.value, std::sqrt(std::numbers::pi), 1e-15);
+
+    // 関数値が等しい2点からは進めない
+    constexpr auto result_2 = tunum::secant{[](double x) { return x * x - 1; }}.solve(-2., 2.);
+    EXPECT_FALSE(result_2.converged);
+}
+
+TEST(TunumNumericalCalcTest, BrentTest)
+{
+    constexpr auto f = [](double x) { return x * x * x - x - 1; };
+    constexpr auto result_1 = tunum::brent{f}.solve(1., 2.);
+    EXPECT_TRUE(result_1.converged);
+    EXPECT_NEAR(result_1.value, 1.3247179572447460, 1e-15);
+
+    // ニュートン法では発散する関数でも、区間内で収束する
+    const auto g = [](double x) { return std::cbrt(x); };
+    const auto result_2 = tunum::brent{g}.solve(-1., 2., tunum::step_tolerance{1e-12});
+    EXPECT_TRUE(result_2.converged);
+    EXPECT_NEAR(result_2.value, 0., 1e-12);
+
+    EXPECT_THROW(tunum::brent{f}.solve(2., 3.), std::invalid_argument);
+}
+
+TEST(TunumNumericalCalcTest, FmpintSolverTest)
+{
+    using int128_t = tunum::fmpint<16, true>;
+
+    // 整数の平方根
+    // 除算の切り捨てにより変化量が0となった時点で止まるため、真値より最大1大きい値となる
+    constexpr auto target = int128_t{1} << 100;
+    const auto newton_result = tunum::newton_raphson{
+            [target](const int128_t& x) { return int128_t{x * x - target}; },
+            [](const int128_t& x) { return int128_t{x * 2}; }
+        }
+        .solve(int128_t{1} << 60);
+    EXPECT_TRUE(newton_result.converged);
+    EXPECT_TRUE(newton_result.value - (int128_t{1} << 50) <= 1);
+
+    const auto brent_result = tunum::brent{
+            [](const int128_t& x) { return int128_t{x * x * x - 1'000'000'000}; }
+        }
+        .solve(int128_t{0}, int128_t{1'000'000});
+    EXPECT_TRUE(brent_result.converged);
+    EXPECT_TRUE(brent_result.value == 1000);
+}